@@ -55,14 +55,20 @@ Java_yancey_chelper_core_CHelperCore_create0(
                 return reinterpret_cast<jlong>(nullptr);
             }
             size_t dataFileSize = AAsset_getLength(asset);
-            char *buffer = new char[dataFileSize];
-            int numBytesRead = AAsset_read(asset, buffer, dataFileSize);
-            AAsset_close(asset);
-            std::istringstream iss(std::string(buffer, numBytesRead));
-            CHelper::CHelperCore *core = CHelper::CHelperCore::create([&iss]() {
-                return CHelper::CPack::createByBinary(iss);
-            });
-            delete[] buffer;
+            // 未压缩的资源会直接映射到内存中，不需要复制，压缩的资源才需要读取到内存中
+            // 命令的节点延迟加载，所以资源包会一直持有这段内存
+            std::shared_ptr<const void> owner;
+            const char *buffer = static_cast<const char *>(AAsset_getBuffer(asset));
+            if (HEDLEY_LIKELY(buffer != nullptr)) {
+                owner = std::shared_ptr<AAsset>(asset, AAsset_close);
+            } else {
+                auto uncompressed = std::make_shared<std::vector<char>>(dataFileSize);
+                dataFileSize = std::max(AAsset_read(asset, uncompressed->data(), dataFileSize), 0);
+                AAsset_close(asset);
+                buffer = uncompressed->data();
+                owner = std::move(uncompressed);
+            }
+            CHelper::CHelperCore *core = CHelper::CHelperCore::createByBinary(buffer, dataFileSize, owner);
             return reinterpret_cast<jlong>(core);
         }
     } catch (...) {
@@ -150,7 +156,7 @@ Java_yancey_chelper_core_CHelperCore_getSuggestionsSize0(
         CHELPER_WARN("call Java_yancey_chelper_core_CHelperCore_getSuggestionsSize0 when core is nullptr");
         return 0;
     }
-    return static_cast<jint>(core->getSuggestions()->size());
+    return static_cast<jint>(core->getSuggestionCount());
 }
 
 extern "C" [[maybe_unused]] JNIEXPORT jobject JNICALL
@@ -165,12 +171,13 @@ Java_yancey_chelper_core_CHelperCore_getSuggestion0(
         CHELPER_WARN("call Java_yancey_chelper_core_CHelperCore_getSuggestion0 when which < 0");
         return nullptr;
     }
-    auto suggestions = core->getSuggestions();
-    if (HEDLEY_UNLIKELY(suggestions->size() <= which)) {
-        CHELPER_WARN("call Java_yancey_chelper_core_CHelperCore_getSuggestion0 when suggestions->size() <= which");
+    // 只创建需要的补全提示，不需要生成所有的补全提示
+    std::vector<CHelper::Suggestion> suggestions = core->getSuggestions(which, 1);
+    if (HEDLEY_UNLIKELY(suggestions.empty())) {
+        CHELPER_WARN("call Java_yancey_chelper_core_CHelperCore_getSuggestion0 when suggestion count <= which");
         return nullptr;
     }
-    CHelper::Suggestion suggestion = suggestions->at(which);
+    const CHelper::Suggestion &suggestion = suggestions[0];
     jclass suggestionClass = env->FindClass("yancey/chelper/core/Suggestion");
     jobject javaSuggestion = env->AllocObject(suggestionClass);
     env->SetObjectField(javaSuggestion,
@@ -186,14 +193,19 @@ Java_yancey_chelper_core_CHelperCore_getSuggestion0(
 
 extern "C" [[maybe_unused]] JNIEXPORT jobject JNICALL
 Java_yancey_chelper_core_CHelperCore_getSuggestions0(
-        JNIEnv *env, [[maybe_unused]] jobject thiz, jlong pointer) {
+        JNIEnv *env, [[maybe_unused]] jobject thiz, jlong pointer, jint offset, jint limit) {
     auto *core = reinterpret_cast<CHelper::CHelperCore *>(pointer);
     jclass suggestionClass = env->FindClass("yancey/chelper/core/Suggestion");
     if (HEDLEY_UNLIKELY(core == nullptr)) {
         CHELPER_WARN("call Java_yancey_chelper_core_CHelperCore_getSuggestions0 when core is nullptr");
         return env->NewObjectArray(0, suggestionClass, nullptr);
     }
-    const std::vector<CHelper::Suggestion> &suggestions = *core->getSuggestions();
+    if (HEDLEY_UNLIKELY(offset < 0 || limit < 0)) {
+        CHELPER_WARN("call Java_yancey_chelper_core_CHelperCore_getSuggestions0 when offset < 0 or limit < 0");
+        return env->NewObjectArray(0, suggestionClass, nullptr);
+    }
+    // 只创建[offset, offset + limit)中的补全提示，不需要生成所有的补全提示
+    const std::vector<CHelper::Suggestion> suggestions = core->getSuggestions(offset, limit);
     jobjectArray result = env->NewObjectArray(static_cast<jsize>(suggestions.size()), suggestionClass, nullptr);
     for (int i = 0; i < suggestions.size(); ++i) {
         const CHelper::Suggestion &item = suggestions[i];
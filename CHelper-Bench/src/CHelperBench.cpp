@@ -0,0 +1,378 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <benchmark/benchmark.h>
+
+#include <chelper/CHelperCore.h>
+#include <chelper/parser/CommandGenerator.h>
+#include <chelper/parser/CursorIndex.h>
+#include <chelper/parser/Parser.h>
+#include <fstream>
+
+namespace CHelper::Bench {
+
+    /**
+     * 资源包的分支和版本
+     */
+    struct CPackVariant {
+        std::string branch1, branch2;
+
+        [[nodiscard]] std::string getName() const {
+            return branch1 + '-' + branch2;
+        }
+
+        [[nodiscard]] std::filesystem::path getPath() const {
+            return std::filesystem::path(RESOURCE_DIR) / "resources" / branch1 / branch2;
+        }
+    };
+
+    static const std::vector<CPackVariant> cpackVariants = {
+            {"release", "vanilla"},
+            {"release", "experiment"},
+            {"beta", "vanilla"},
+            {"beta", "experiment"},
+            {"netease", "vanilla"},
+            {"netease", "experiment"},
+    };
+
+    /**
+     * 读取测试命令，以-开头的行会被忽略
+     */
+    static std::vector<std::u16string> readCorpus(const std::filesystem::path &path) {
+        std::vector<std::u16string> commands;
+        std::ifstream fin(path, std::ios::in);
+        std::string str;
+        while (std::getline(fin, str)) {
+            if (HEDLEY_UNLIKELY(!str.empty() && str[str.length() - 1] == '\r')) {
+                str.pop_back();
+            }
+            if (HEDLEY_UNLIKELY(str.empty() || str[0] == '-')) {
+                continue;
+            }
+            commands.push_back(utf8::utf8to16(str));
+        }
+        return commands;
+    }
+
+    static const std::vector<std::u16string> &getCorpus() {
+        static std::vector<std::u16string> corpus = readCorpus(std::filesystem::path(RESOURCE_DIR) / "test" / "bench.txt");
+        return corpus;
+    }
+
+    /**
+     * 每个资源包只创建一次，所有测试共用
+     */
+    static CHelperCore *getCore(const CPackVariant &variant) {
+        static std::unordered_map<std::string, std::unique_ptr<CHelperCore>> cores;
+        std::unique_ptr<CHelperCore> &core = cores[variant.getName()];
+        if (HEDLEY_UNLIKELY(core == nullptr)) {
+            core.reset(CHelperCore::createByDirectory(variant.getPath()));
+            if (HEDLEY_UNLIKELY(core == nullptr)) {
+                throw std::runtime_error("fail to load cpack: " + variant.getName());
+            }
+        }
+        return core.get();
+    }
+
+    /**
+     * 根据资源包随机生成的命令，包括没有错误的命令和有一个字符错误的命令，随机种子固定
+     */
+    static const std::vector<std::u16string> &getGeneratedCorpus(const CPackVariant &variant) {
+        static std::unordered_map<std::string, std::vector<std::u16string>> generatedCorpus;
+        std::vector<std::u16string> &result = generatedCorpus[variant.getName()];
+        if (HEDLEY_UNLIKELY(result.empty())) {
+            GeneratedCommands commands = generateCommands(*getCore(variant)->getCPack(), 1000, 1000, 0);
+            result = std::move(commands.valid);
+            result.insert(result.end(),
+                          std::make_move_iterator(commands.nearValid.begin()),
+                          std::make_move_iterator(commands.nearValid.end()));
+        }
+        return result;
+    }
+
+    static const std::vector<ASTNode> &getASTNodes(const CPackVariant &variant) {
+        static std::unordered_map<std::string, std::vector<ASTNode>> astNodes;
+        std::vector<ASTNode> &result = astNodes[variant.getName()];
+        if (HEDLEY_UNLIKELY(result.empty())) {
+            const CPack *cpack = getCore(variant)->getCPack();
+            for (const auto &command: getCorpus()) {
+                result.push_back(Parser::parse(command, cpack));
+            }
+        }
+        return result;
+    }
+
+    static std::filesystem::path getTempPath(const CPackVariant &variant, const std::string &fileType) {
+        return std::filesystem::temp_directory_path() / "chelper-bench" / (variant.getName() + '.' + fileType);
+    }
+
+    /**
+     * 遍历每个AST节点，每次迭代处理全部测试命令
+     */
+    template<class Function>
+    static void forEachASTNode(benchmark::State &state, const CPackVariant &variant, Function function) {
+        const std::vector<std::u16string> &corpus = getCorpus();
+        const std::vector<ASTNode> &astNodes = getASTNodes(variant);
+        for (auto _: state) {
+            for (size_t i = 0; i < astNodes.size(); ++i) {
+                function(astNodes[i], corpus[i]);
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * corpus.size()));
+    }
+
+    static void lex(benchmark::State &state, const CPackVariant &variant) {
+        const std::vector<std::u16string> &corpus = getCorpus();
+        for (auto _: state) {
+            for (const auto &command: corpus) {
+                benchmark::DoNotOptimize(Lexer::lex(command));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * corpus.size()));
+    }
+
+    static void parse(benchmark::State &state, const CPackVariant &variant) {
+        const std::vector<std::u16string> &corpus = getCorpus();
+        const CPack *cpack = getCore(variant)->getCPack();
+        for (auto _: state) {
+            for (const auto &command: corpus) {
+                benchmark::DoNotOptimize(Parser::parse(command, cpack));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * corpus.size()));
+    }
+
+    /**
+     * 使用备忘录解析，同时记录每条命令平均真正解析的节点数和复用的次数
+     *
+     * @param isEnableCache false-只统计节点的解析次数，作为对照
+     */
+    static void parseWithMemo(benchmark::State &state, const CPackVariant &variant, bool isEnableCache) {
+        const std::vector<std::u16string> &corpus = getCorpus();
+        const CPack *cpack = getCore(variant)->getCPack();
+        size_t visitCount = 0, hitCount = 0;
+        for (auto _: state) {
+            for (const auto &command: corpus) {
+                ParseMemo parseMemo(isEnableCache);
+                benchmark::DoNotOptimize(Parser::parse(command, cpack, parseMemo));
+                visitCount += parseMemo.visitCount;
+                hitCount += parseMemo.hitCount;
+            }
+        }
+        auto count = static_cast<double>(state.iterations() * corpus.size());
+        state.counters["visits"] = static_cast<double>(visitCount) / count;
+        state.counters["hits"] = static_cast<double>(hitCount) / count;
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * corpus.size()));
+    }
+
+    static void parseWithMemo(benchmark::State &state, const CPackVariant &variant) {
+        parseWithMemo(state, variant, true);
+    }
+
+    static void parseWithoutMemo(benchmark::State &state, const CPackVariant &variant) {
+        parseWithMemo(state, variant, false);
+    }
+
+    static void parseGenerated(benchmark::State &state, const CPackVariant &variant) {
+        const std::vector<std::u16string> &corpus = getGeneratedCorpus(variant);
+        const CPack *cpack = getCore(variant)->getCPack();
+        for (auto _: state) {
+            for (const auto &command: corpus) {
+                benchmark::DoNotOptimize(Parser::parse(command, cpack));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * corpus.size()));
+    }
+
+    static void getDescription(benchmark::State &state, const CPackVariant &variant) {
+        forEachASTNode(state, variant, [](const ASTNode &astNode, const std::u16string &command) {
+            benchmark::DoNotOptimize(astNode.getDescription(command.length()));
+        });
+    }
+
+    static void getErrorReasons(benchmark::State &state, const CPackVariant &variant) {
+        forEachASTNode(state, variant, [](const ASTNode &astNode, const std::u16string &command) {
+            benchmark::DoNotOptimize(astNode.getErrorReasons());
+        });
+    }
+
+    static void getSuggestions(benchmark::State &state, const CPackVariant &variant) {
+        forEachASTNode(state, variant, [](const ASTNode &astNode, const std::u16string &command) {
+            benchmark::DoNotOptimize(astNode.getSuggestions(command.length()));
+        });
+    }
+
+    static void getStructure(benchmark::State &state, const CPackVariant &variant) {
+        forEachASTNode(state, variant, [](const ASTNode &astNode, const std::u16string &command) {
+            benchmark::DoNotOptimize(astNode.getStructure());
+        });
+    }
+
+    static void getColors(benchmark::State &state, const CPackVariant &variant) {
+        Theme theme;
+        forEachASTNode(state, variant, [&theme](const ASTNode &astNode, const std::u16string &command) {
+            benchmark::DoNotOptimize(astNode.getColors(theme));
+        });
+    }
+
+    /**
+     * 内容不变时把光标依次移动到命令的每个位置，每个位置都获取说明和补全提示
+     *
+     * @param isEnableCursorIndex true-每条命令构建一次光标位置的索引，构建的时间也统计在内，false-每次都从根节点遍历，作为对照
+     */
+    static void moveSelection(benchmark::State &state, const CPackVariant &variant, bool isEnableCursorIndex) {
+        forEachASTNode(state, variant, [isEnableCursorIndex](const ASTNode &astNode, const std::u16string &command) {
+            std::unique_ptr<CursorIndex> cursorIndex;
+            if (HEDLEY_LIKELY(isEnableCursorIndex)) {
+                cursorIndex = std::make_unique<CursorIndex>(astNode);
+            }
+            for (size_t index = 0; index <= command.length(); ++index) {
+                benchmark::DoNotOptimize(astNode.getDescription(index, cursorIndex.get()));
+                benchmark::DoNotOptimize(astNode.getSuggestions(index, cursorIndex.get()));
+            }
+        });
+    }
+
+    static void moveSelectionWithIndex(benchmark::State &state, const CPackVariant &variant) {
+        moveSelection(state, variant, true);
+    }
+
+    static void moveSelectionWithoutIndex(benchmark::State &state, const CPackVariant &variant) {
+        moveSelection(state, variant, false);
+    }
+
+    /**
+     * 只统计点击补全提示的时间，解析和获取补全提示的时间不统计
+     */
+    static void onSuggestionClick(benchmark::State &state, const CPackVariant &variant) {
+        const std::vector<std::u16string> &corpus = getCorpus();
+        CHelperCore *core = getCore(variant);
+        size_t count = 0;
+        for (auto _: state) {
+            for (const auto &command: corpus) {
+                state.PauseTiming();
+                core->onTextChanged(command, command.length());
+                size_t suggestionSize = core->getSuggestions()->size();
+                state.ResumeTiming();
+                if (HEDLEY_LIKELY(suggestionSize > 0)) {
+                    benchmark::DoNotOptimize(core->onSuggestionClick(0));
+                    count++;
+                }
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(count));
+    }
+
+    static void loadByDirectory(benchmark::State &state, const CPackVariant &variant) {
+        for (auto _: state) {
+            benchmark::DoNotOptimize(CPack::createByDirectory(variant.getPath()));
+        }
+    }
+
+    static void loadByJson(benchmark::State &state, const CPackVariant &variant) {
+        std::filesystem::path path = getTempPath(variant, "json");
+        getCore(variant)->getCPack()->writeJsonToFile(path);
+        for (auto _: state) {
+            benchmark::DoNotOptimize(CPack::createByJson(serialization::get_json_from_file(path)));
+        }
+    }
+
+    static void loadByBinary(benchmark::State &state, const CPackVariant &variant) {
+        std::filesystem::path path = getTempPath(variant, "cpack");
+        getCore(variant)->getCPack()->writeBinToFile(path);
+        for (auto _: state) {
+            std::unique_ptr<CHelperCore> core(CHelperCore::createByBinary(path));
+            benchmark::DoNotOptimize(core);
+        }
+    }
+
+    /**
+     * 从映射的二进制资源包加载后立即获取一次方块状态的补全提示，方块ID、JSON数据等内容在这时才读取和初始化
+     */
+    static void loadByBinaryFirstSuggestion(benchmark::State &state, const CPackVariant &variant) {
+        std::filesystem::path path = getTempPath(variant, "cpack");
+        getCore(variant)->getCPack()->writeBinToFile(path);
+        std::u16string command = u"setblock ~~~ stone[";
+        for (auto _: state) {
+            std::unique_ptr<CHelperCore> core(CHelperCore::createByBinary(path));
+            core->onTextChanged(command, command.length());
+            benchmark::DoNotOptimize(core->getSuggestions());
+        }
+    }
+
+    /**
+     * 从映射的二进制资源包加载后读取所有延迟读取的内容，作为对照
+     */
+    static void loadByBinaryAllSections(benchmark::State &state, const CPackVariant &variant) {
+        std::filesystem::path path = getTempPath(variant, "cpack");
+        getCore(variant)->getCPack()->writeBinToFile(path);
+        for (auto _: state) {
+            std::unique_ptr<CHelperCore> core(CHelperCore::createByBinary(path));
+            core->getCPack()->loadSections();
+            benchmark::DoNotOptimize(core);
+        }
+    }
+
+    static void registerBenchmarks() {
+        const std::vector<std::pair<std::string, void (*)(benchmark::State &, const CPackVariant &)>> stages = {
+                {"Lexer::lex", lex},
+                {"Parser::parse", parse},
+                {"Parser::parse(memo)", parseWithMemo},
+                {"Parser::parse(memo off)", parseWithoutMemo},
+                {"Parser::parse(generated)", parseGenerated},
+                {"getDescription", getDescription},
+                {"getErrorReasons", getErrorReasons},
+                {"getSuggestions", getSuggestions},
+                {"getStructure", getStructure},
+                {"getColors", getColors},
+                {"moveSelection", moveSelectionWithIndex},
+                {"moveSelection(index off)", moveSelectionWithoutIndex},
+                {"onSuggestionClick", onSuggestionClick},
+        };
+        const std::vector<std::pair<std::string, void (*)(benchmark::State &, const CPackVariant &)>> loaders = {
+                {"CPack::createByDirectory", loadByDirectory},
+                {"CPack::createByJson", loadByJson},
+                {"CPack::createByBinary", loadByBinary},
+                {"CPack::createByBinary(first suggestion)", loadByBinaryFirstSuggestion},
+                {"CPack::createByBinary(all sections)", loadByBinaryAllSections},
+        };
+        for (const auto &variant: cpackVariants) {
+            for (const auto &item: stages) {
+                benchmark::RegisterBenchmark((item.first + '/' + variant.getName()).c_str(), item.second, variant)
+                        ->Unit(benchmark::kMillisecond);
+            }
+            for (const auto &item: loaders) {
+                benchmark::RegisterBenchmark((item.first + '/' + variant.getName()).c_str(), item.second, variant)
+                        ->Unit(benchmark::kMillisecond)
+                        ->Iterations(3);
+            }
+        }
+    }
+
+}// namespace CHelper::Bench
+
+/**
+ * 没有指定输出文件时，结果会以JSON格式写入CHelperBench.json，方便比较不同版本的性能
+ */
+int main(int argc, char **argv) {
+    std::vector<char *> args(argv, argv + argc);
+    bool hasOutput = std::any_of(args.begin(), args.end(), [](const char *arg) {
+        return std::string_view(arg).substr(0, 16) == "--benchmark_out=";
+    });
+    std::string outArg = "--benchmark_out=CHelperBench.json";
+    std::string outFormatArg = "--benchmark_out_format=json";
+    if (HEDLEY_LIKELY(!hasOutput)) {
+        args.push_back(outArg.data());
+        args.push_back(outFormatArg.data());
+    }
+    int size = static_cast<int>(args.size());
+    benchmark::Initialize(&size, args.data());
+    if (HEDLEY_UNLIKELY(benchmark::ReportUnrecognizedArguments(size, args.data()))) {
+        return 1;
+    }
+    CHelper::Bench::registerBenchmarks();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
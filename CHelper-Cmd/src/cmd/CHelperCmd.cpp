@@ -3,11 +3,20 @@
 //
 
 #include "CHelperCmd.h"
+#include <chelper/node/NodeType.h>
+#include <chelper/parser/Batch.h>
+#include <chelper/parser/CommandGenerator.h>
 #include <chelper/parser/Parser.h>
+#include <thread>
 
 int main() {
     //    testDir();
     //    testBin();
+    //    testParseMemo();
+    //    testBatch();
+    //    generateCommands();
+    //    testStatistics();
+    //    testTrace();
     outputFile(CHelper::Test::writeSingleJson, "json");
     outputFile(CHelper::Test::writeBinary, "cpack");
     outputOld2New();
@@ -30,6 +39,40 @@ int main() {
                            true);
 }
 
+[[maybe_unused]] void testParseMemo() {
+    std::filesystem::path resourceDir(RESOURCE_DIR);
+    CHelper::Test::testParseMemo(resourceDir / "resources" / "beta" / "vanilla",
+                                 resourceDir / "test" / "test.txt");
+}
+
+[[maybe_unused]] void testBatch() {
+    std::filesystem::path resourceDir(RESOURCE_DIR);
+    CHelper::Test::testBatch(resourceDir / "resources" / "beta" / "vanilla",
+                             resourceDir / "test" / "test.txt");
+}
+
+[[maybe_unused]] void generateCommands() {
+    std::filesystem::path resourceDir(RESOURCE_DIR);
+    CHelper::Test::generateCommands(resourceDir / "resources" / "beta" / "vanilla",
+                                    resourceDir / "run" / "test",
+                                    10000, 10000, 0);
+}
+
+[[maybe_unused]] void testStatistics() {
+    std::filesystem::path resourceDir(RESOURCE_DIR);
+    CHelper::Test::testStatistics(resourceDir / "resources" / "beta" / "vanilla",
+                                  resourceDir / "test" / "test.txt");
+}
+
+#ifdef CHelperTrace
+[[maybe_unused]] void testTrace() {
+    std::filesystem::path resourceDir(RESOURCE_DIR);
+    CHelper::Test::testTrace(resourceDir / "resources" / "beta" / "vanilla",
+                             resourceDir / "test" / "test.txt",
+                             resourceDir / "run" / "trace.json");
+}
+#endif
+
 [[maybe_unused]] void outputFile(
         const std::filesystem::path &projectDir,
         void function(const std::filesystem::path &input, const std::filesystem::path &output),
@@ -73,9 +116,9 @@ void outputOld2New() {
 namespace CHelper::Test {
 
     /**
-     * 读取测试文件进行测试
+     * 读取测试文件，以-开头的行会被忽略
      */
-    [[maybe_unused]] void testDir(const std::filesystem::path &cpackPath, const std::filesystem::path &testFilePath, bool isTestTime) {
+    std::vector<std::u16string> readTestFile(const std::filesystem::path &testFilePath) {
         std::vector<std::u16string> commands;
         std::ifstream fin;
         fin.open(testFilePath, std::ios::in);
@@ -94,6 +137,14 @@ namespace CHelper::Test {
             commands.push_back(utf8::utf8to16(str));
         }
         fin.close();
+        return commands;
+    }
+
+    /**
+     * 读取测试文件进行测试
+     */
+    [[maybe_unused]] void testDir(const std::filesystem::path &cpackPath, const std::filesystem::path &testFilePath, bool isTestTime) {
+        std::vector<std::u16string> commands = readTestFile(testFilePath);
         CHelper::Test::testDir(cpackPath, commands, isTestTime);
         //        std::vector<std::u16string> commands1;
         //        for (const auto &item: commands) {
@@ -109,24 +160,7 @@ namespace CHelper::Test {
      * 读取测试文件进行测试
      */
     [[maybe_unused]] void testBin(const std::filesystem::path &cpackPath, const std::filesystem::path &testFilePath, bool isTestTime) {
-        std::vector<std::u16string> commands;
-        std::ifstream fin;
-        fin.open(testFilePath, std::ios::in);
-        while (fin.is_open()) {
-            std::string str;
-            getline(fin, str);
-            if (HEDLEY_UNLIKELY(str.empty())) {
-                break;
-            }
-            if (HEDLEY_LIKELY(str[0] == '-')) {
-                continue;
-            }
-            if (HEDLEY_UNLIKELY(str[str.length() - 1] == '\r')) {
-                str = str.substr(0, str.length() - 1);
-            }
-            commands.push_back(utf8::utf8to16(str));
-        }
-        fin.close();
+        std::vector<std::u16string> commands = readTestFile(testFilePath);
         CHelper::Test::testBin(cpackPath, commands, isTestTime);
     }
 
@@ -301,6 +335,198 @@ namespace CHelper::Test {
         delete core;
     }
 
+    /**
+     * 对比使用备忘录和不使用备忘录时节点的解析次数和解析时间
+     */
+    [[maybe_unused]] void testParseMemo(const std::filesystem::path &cpackPath, const std::filesystem::path &testFilePath) {
+        std::vector<std::u16string> commands = readTestFile(testFilePath);
+        CHelperCore *core = nullptr;
+        try {
+            core = CHelperCore::createByDirectory(cpackPath);
+            fmt::print("\n");
+            if (HEDLEY_UNLIKELY(core == nullptr)) {
+                return;
+            }
+            for (bool isEnableCache: {false, true}) {
+                size_t visitCount = 0, hitCount = 0;
+                std::chrono::high_resolution_clock::time_point start, end;
+                start = std::chrono::high_resolution_clock::now();
+                for (const auto &command: commands) {
+                    ParseMemo parseMemo(isEnableCache);
+                    ASTNode astNode = Parser::parse(command, core->getCPack(), parseMemo);
+                    visitCount += parseMemo.visitCount;
+                    hitCount += parseMemo.hitCount;
+                }
+                end = std::chrono::high_resolution_clock::now();
+                fmt::print("{}: {} node visits, {} memo hits, {} commands ({})\n",
+                           isEnableCache ? "with parse memo" : "without parse memo",
+                           fmt::styled(visitCount, fg(fmt::color::medium_purple)),
+                           fmt::styled(hitCount, fg(fmt::color::medium_purple)),
+                           commands.size(),
+                           fmt::styled(std::to_string(std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(end - start).count()) + "ms", fg(fmt::color::medium_purple)));
+            }
+        } catch (const std::exception &e) {
+            Profile::printAndClear(e);
+            exit(-1);
+        }
+        delete core;
+    }
+
+    [[maybe_unused]] void testBatch(const std::filesystem::path &cpackPath, const std::filesystem::path &testFilePath) {
+        std::vector<std::u16string> commands = readTestFile(testFilePath);
+        std::vector<std::u16string_view> lines(commands.begin(), commands.end());
+        CHelperCore *core = nullptr;
+        try {
+            core = CHelperCore::createByDirectory(cpackPath);
+            fmt::print("\n");
+            if (HEDLEY_UNLIKELY(core == nullptr)) {
+                return;
+            }
+            size_t maxThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+            for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+                size_t errorCount = 0;
+                std::chrono::high_resolution_clock::time_point start, end;
+                start = std::chrono::high_resolution_clock::now();
+                for (const auto &item: Batch::validate(*core->getCPack(), lines, threads)) {
+                    errorCount += item.size();
+                }
+                end = std::chrono::high_resolution_clock::now();
+                fmt::print("{} threads: {} errors, {} commands ({})\n",
+                           threads,
+                           fmt::styled(errorCount, fg(fmt::color::medium_purple)),
+                           commands.size(),
+                           fmt::styled(std::to_string(std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(end - start).count()) + "ms", fg(fmt::color::medium_purple)));
+            }
+        } catch (const std::exception &e) {
+            Profile::printAndClear(e);
+            exit(-1);
+        }
+        delete core;
+    }
+
+    [[maybe_unused]] void testStatistics(const std::filesystem::path &cpackPath, const std::filesystem::path &testFilePath) {
+        std::vector<std::u16string> commands = readTestFile(testFilePath);
+        CHelperCore *core = nullptr;
+        try {
+            core = CHelperCore::createByDirectory(cpackPath);
+            fmt::print("\n");
+            if (HEDLEY_UNLIKELY(core == nullptr)) {
+                return;
+            }
+            core->settings.isEnableStatistics = true;
+            for (const auto &command: commands) {
+                core->onTextChanged(command, command.length());
+                core->getDescription();
+                core->getErrorReasons();
+                core->getSuggestions();
+                core->getStructure();
+                core->getColors();
+            }
+            CoreStatistics statistics = core->getStatistics();
+            fmt::print("{} parses, {} getASTNode calls, {} backtrack tokens\n",
+                       fmt::styled(statistics.parseCount, fg(fmt::color::medium_purple)),
+                       fmt::styled(statistics.total.getASTNodeCount(), fg(fmt::color::medium_purple)),
+                       fmt::styled(statistics.total.backtrackTokens, fg(fmt::color::medium_purple)));
+            // 解析次数从多到少输出
+            std::vector<std::pair<size_t, Node::NodeTypeId::NodeTypeId>> counts;
+            for (size_t i = 0; i <= Node::MAX_TYPE_ID; ++i) {
+                counts.emplace_back(statistics.total.getASTNodeCounts[i], static_cast<Node::NodeTypeId::NodeTypeId>(i));
+            }
+            std::stable_sort(counts.begin(), counts.end(), [](const auto &item1, const auto &item2) {
+                return item1.first > item2.first;
+            });
+            for (const auto &item: counts) {
+                if (HEDLEY_UNLIKELY(item.first == 0)) {
+                    break;
+                }
+                fmt::print("{}: {} calls ({:.1f} per parse)\n",
+                           utf8::utf16to8(Node::NodeTypeHelper::getName(item.second)),
+                           fmt::styled(item.first, fg(fmt::color::medium_purple)),
+                           static_cast<double>(item.first) / static_cast<double>(std::max<size_t>(1, statistics.parseCount)));
+            }
+            for (size_t i = 0; i < CoreEntryPoint::COUNT; ++i) {
+                const LatencySnapshot &latency = statistics.latencies[i];
+                fmt::print("{}: {} calls, p50 {}, p99 {}, max {}\n",
+                           CoreEntryPoint::NAMES[i],
+                           latency.count,
+                           fmt::styled(std::to_string(static_cast<double>(latency.p50) / 1000.0) + "us", fg(fmt::color::medium_purple)),
+                           fmt::styled(std::to_string(static_cast<double>(latency.p99) / 1000.0) + "us", fg(fmt::color::medium_purple)),
+                           fmt::styled(std::to_string(static_cast<double>(latency.max) / 1000.0) + "us", fg(fmt::color::medium_purple)));
+            }
+        } catch (const std::exception &e) {
+            Profile::printAndClear(e);
+            exit(-1);
+        }
+        delete core;
+    }
+
+#ifdef CHelperTrace
+    [[maybe_unused]] void testTrace(const std::filesystem::path &cpackPath,
+                                    const std::filesystem::path &testFilePath,
+                                    const std::filesystem::path &outputPath) {
+        std::vector<std::u16string> commands = readTestFile(testFilePath);
+        CHelperCore *core = nullptr;
+        try {
+            Trace::clear();
+            Trace::setEnabled(true);
+            core = CHelperCore::createByDirectory(cpackPath);
+            if (HEDLEY_UNLIKELY(core == nullptr)) {
+                Trace::setEnabled(false);
+                return;
+            }
+            for (const auto &command: commands) {
+                core->onTextChanged(command, command.length());
+            }
+            Trace::setEnabled(false);
+            Trace::writeChromeTrace(outputPath);
+            fmt::print("trace of {} commands is written to {}\n",
+                       fmt::styled(commands.size(), fg(fmt::color::medium_purple)),
+                       fmt::styled(outputPath.string(), fg(fmt::color::medium_purple)));
+        } catch (const std::exception &e) {
+            Profile::printAndClear(e);
+            exit(-1);
+        }
+        delete core;
+    }
+#endif
+
+    static void writeTestFile(const std::filesystem::path &path, const std::vector<std::u16string> &commands) {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream fout(path, std::ios::out | std::ios::binary);
+        for (const auto &command: commands) {
+            fout << utf8::utf16to8(command) << '\n';
+        }
+    }
+
+    [[maybe_unused]] void generateCommands(const std::filesystem::path &cpackPath,
+                                           const std::filesystem::path &outputDir,
+                                           size_t validCount,
+                                           size_t nearValidCount,
+                                           uint32_t seed) {
+        CHelperCore *core = nullptr;
+        try {
+            core = CHelperCore::createByDirectory(cpackPath);
+            fmt::print("\n");
+            if (HEDLEY_UNLIKELY(core == nullptr)) {
+                return;
+            }
+            std::chrono::high_resolution_clock::time_point start, end;
+            start = std::chrono::high_resolution_clock::now();
+            GeneratedCommands commands = CHelper::generateCommands(*core->getCPack(), validCount, nearValidCount, seed);
+            end = std::chrono::high_resolution_clock::now();
+            fmt::print("{} valid commands, {} near-valid commands ({})\n",
+                       fmt::styled(commands.valid.size(), fg(fmt::color::medium_purple)),
+                       fmt::styled(commands.nearValid.size(), fg(fmt::color::medium_purple)),
+                       fmt::styled(std::to_string(std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(end - start).count()) + "ms", fg(fmt::color::medium_purple)));
+            writeTestFile(outputDir / "generated-valid.txt", commands.valid);
+            writeTestFile(outputDir / "generated-near-valid.txt", commands.nearValid);
+        } catch (const std::exception &e) {
+            Profile::printAndClear(e);
+            exit(-1);
+        }
+        delete core;
+    }
+
     [[maybe_unused]] void writeDirectory(const std::u16string &input, const std::filesystem::path &output) {
         CHelperCore *core = nullptr;
         CHelperCore *core2 = nullptr;
@@ -18,6 +18,18 @@ int main();
 
 [[maybe_unused]] void testBin();
 
+[[maybe_unused]] void testParseMemo();
+
+[[maybe_unused]] void testBatch();
+
+[[maybe_unused]] void generateCommands();
+
+[[maybe_unused]] void testStatistics();
+
+#ifdef CHelperTrace
+[[maybe_unused]] void testTrace();
+#endif
+
 [[maybe_unused]] void outputFile(
         const std::filesystem::path &projectDir,
         void function(const std::filesystem::path &input, const std::filesystem::path &output),
@@ -34,6 +46,8 @@ int main();
 
 namespace CHelper::Test {
 
+    std::vector<std::u16string> readTestFile(const std::filesystem::path &testFilePath);
+
     [[maybe_unused]] void testDir(const std::filesystem::path &cpackPath, const std::filesystem::path &testFilePath, bool isTestTime);
 
     [[maybe_unused]] void testBin(const std::filesystem::path &cpackPath, const std::filesystem::path &testFilePath, bool isTestTime);
@@ -46,6 +60,33 @@ namespace CHelper::Test {
 
     [[maybe_unused]] void test2(const std::filesystem::path &cpackPath, const std::vector<std::u16string> &commands, int times);
 
+    [[maybe_unused]] void testParseMemo(const std::filesystem::path &cpackPath, const std::filesystem::path &testFilePath);
+
+    [[maybe_unused]] void testBatch(const std::filesystem::path &cpackPath, const std::filesystem::path &testFilePath);
+
+    /**
+     * 随机生成测试命令，写入outputDir中的generated-valid.txt和generated-near-valid.txt，每行一条命令
+     */
+    [[maybe_unused]] void generateCommands(const std::filesystem::path &cpackPath,
+                                           const std::filesystem::path &outputDir,
+                                           size_t validCount,
+                                           size_t nearValidCount,
+                                           uint32_t seed);
+
+    /**
+     * 输出每种节点的解析次数、回溯的token数量和CHelperCore每个方法的耗时
+     */
+    [[maybe_unused]] void testStatistics(const std::filesystem::path &cpackPath, const std::filesystem::path &testFilePath);
+
+#ifdef CHelperTrace
+    /**
+     * 记录读取资源包和解析命令的运行时间，以Chrome的trace_event格式写入outputPath
+     */
+    [[maybe_unused]] void testTrace(const std::filesystem::path &cpackPath,
+                                    const std::filesystem::path &testFilePath,
+                                    const std::filesystem::path &outputPath);
+#endif
+
     [[maybe_unused]] void writeDirectory(const std::filesystem::path &input, const std::filesystem::path &output);
 
     [[maybe_unused]] void writeSingleJson(const std::filesystem::path &input, const std::filesystem::path &output);
@@ -0,0 +1,37 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/resources/CPack.h>
+#include <fstream>
+#include <pch.h>
+
+/**
+ * 把资源包目录转换为二进制资源包，构建时用于生成应用内置的资源包
+ *
+ * 用法：CHelperPack <资源包目录> <输出文件>
+ */
+int main(int argc, char *argv[]) {
+    if (HEDLEY_UNLIKELY(argc != 3)) {
+        CHELPER_ERROR("usage: CHelperPack <input directory> <output file>");
+        return 1;
+    }
+    std::filesystem::path input(argv[1]), output(argv[2]);
+    try {
+        std::unique_ptr<CHelper::CPack> cpack = CHelper::CPack::createByDirectory(input);
+        cpack->writeBinToFile(output);
+        // 重新读取一次，保证生成的资源包可以正常加载
+        std::ifstream istream(output, std::ios::binary);
+        std::unique_ptr<CHelper::CPack> cpack2 = CHelper::CPack::createByBinary(istream);
+        if (HEDLEY_UNLIKELY(istream.peek() != std::ifstream::traits_type::eof())) {
+            CHelper::Profile::push("binary cpack is not read completed");
+            throw std::runtime_error("binary cpack is not read completed");
+        }
+    } catch (const std::exception &e) {
+        CHelper::Profile::printAndClear(e);
+        std::filesystem::remove(output);
+        return 1;
+    }
+    CHELPER_INFO("CPack write successfully: {}", output.u16string());
+    return 0;
+}
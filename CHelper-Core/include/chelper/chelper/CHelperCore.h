@@ -10,19 +10,88 @@
 #include "old2new/Old2New.h"
 #include "settings/Settings.h"
 #include <chelper/parser/ASTNode.h>
+#include <chelper/parser/CursorIndex.h>
+#include <chelper/parser/ParseCache.h>
+#include <chelper/parser/ParseStats.h>
 #include <chelper/resources/CPack.h>
+#include <chelper/util/LatencyHistogram.h>
 #include <pch.h>
 
 
 namespace CHelper {
 
+    namespace CoreEntryPoint {
+        enum CoreEntryPoint : uint8_t {
+            ON_TEXT_CHANGED,
+            GET_DESCRIPTION,
+            GET_ERROR_REASONS,
+            GET_SUGGESTIONS,
+            GET_STRUCTURE,
+            GET_COLORS,
+            ON_SUGGESTION_CLICK,
+            COUNT
+        };
+
+        constexpr std::array<const char *, COUNT> NAMES = {
+                "onTextChanged",
+                "getDescription",
+                "getErrorReasons",
+                "getSuggestions",
+                "getStructure",
+                "getColors",
+                "onSuggestionClick"};
+    }// namespace CoreEntryPoint
+
+    /**
+     * 运行时的统计数据，只有settings.isEnableStatistics为true时才会记录
+     */
+    class CoreStatistics {
+    public:
+        //解析的次数，输入的内容没有改变时不会重新解析
+        size_t parseCount = 0;
+        //最后一次解析的统计数据
+        ParseStats lastParse;
+        //所有解析的统计数据的总和
+        ParseStats total;
+        //每个方法的耗时
+        std::array<LatencySnapshot, CoreEntryPoint::COUNT> latencies;
+    };
+
     class CHelperCore {
     private:
         std::u16string input;
         size_t index = 0;
         std::unique_ptr<CPack> cpack;
         ASTNode astNode;
+        //增量解析使用的缓存，指向astNode中的节点
+        ParseCache parseCache;
         std::shared_ptr<std::vector<Suggestion>> suggestions;
+        //过滤和排序后的补全提示，只在获取某一段时才创建这一段的补全提示
+        std::shared_ptr<SuggestionList> suggestionList;
+        //光标位置到AST节点的索引，内容改变时清空，只移动光标时可以继续使用
+        mutable std::unique_ptr<CursorIndex> cursorIndex;
+        //上一次解析后光标是否移动过，内容改变后的第一次查询直接从根节点遍历，光标移动后才构建cursorIndex
+        bool isSelectionMoved = false;
+        //根据astNode计算的结果，第一次获取时才计算，内容改变时清空，光标位置改变时清空description
+        mutable std::shared_ptr<std::u16string> description;
+        mutable std::shared_ptr<std::vector<std::shared_ptr<ErrorReason>>> errorReasons;
+        mutable std::shared_ptr<std::u16string> structure;
+        mutable std::shared_ptr<ColoredString> colors;
+        //计算colors时使用的主题，主题改变时需要重新计算
+        mutable Theme colorsTheme;
+        //统计数据
+        size_t parseCount = 0;
+        ParseStats lastParseStats;
+        ParseStats totalParseStats;
+        mutable std::array<LatencyHistogram, CoreEntryPoint::COUNT> latencies;
+
+        //没有开启统计时返回nullptr
+        [[nodiscard]] LatencyHistogram *getLatencyHistogram(CoreEntryPoint::CoreEntryPoint entryPoint) const;
+
+        //光标没有移动过时返回nullptr，从根节点遍历
+        [[nodiscard]] const CursorIndex *getCursorIndex() const;
+
+        [[nodiscard]] const SuggestionList *getSuggestionList();
 
     public:
         Settings settings;
@@ -31,6 +100,8 @@ namespace CHelper {
 
         static CHelperCore *create(const std::function<std::unique_ptr<CPack>()> &getCPack);
 
+        static CHelperCore *createByBinary(const char *data, size_t size, const std::shared_ptr<const void> &owner = nullptr);
+
       #ifndef CHELPER_NO_FILESYSTEM
         static CHelperCore *createByDirectory(const std::filesystem::path &cpackPath);
 
@@ -47,18 +118,36 @@ namespace CHelper {
 
         [[nodiscard]] const ASTNode *getAstNode() const;
 
-        [[nodiscard]] std::u16string getDescription() const;
+        /**
+         * 说明、错误原因、结构和颜色在第一次获取时计算，之后返回同一个对象，
+         * 返回的引用在内容、光标位置或主题改变后失效
+         */
+        [[nodiscard]] const std::u16string &getDescription() const;
 
-        [[nodiscard]] std::vector<std::shared_ptr<ErrorReason>> getErrorReasons() const;
+        [[nodiscard]] const std::vector<std::shared_ptr<ErrorReason>> &getErrorReasons() const;
 
         std::vector<Suggestion> *getSuggestions();
 
-        [[nodiscard]] std::u16string getStructure() const;
+        /**
+         * 补全提示的数量，不会创建补全提示
+         */
+        [[nodiscard]] size_t getSuggestionCount();
 
-        [[nodiscard]] ColoredString getColors() const;
+        /**
+         * 分页获取补全提示，只创建[offset, offset + limit)中的补全提示，翻页时不会重新计算
+         */
+        [[nodiscard]] std::vector<Suggestion> getSuggestions(size_t offset, size_t limit);
+
+        [[nodiscard]] const std::u16string &getStructure() const;
+
+        [[nodiscard]] const ColoredString &getColors() const;
 
         [[nodiscard]] std::optional<std::pair<std::u16string, size_t>> onSuggestionClick(size_t which);
 
+        [[nodiscard]] CoreStatistics getStatistics() const;
+
+        void clearStatistics();
+
         static std::u16string old2new(const Old2New::BlockFixData &blockFixData, const std::u16string &old);
     };
 
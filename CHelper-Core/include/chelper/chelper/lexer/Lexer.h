@@ -13,8 +13,24 @@
 
 namespace CHelper::Lexer {
 
+    /**
+     * 文本修改：修改前的内容中[start, start + removeLength)的部分被替换为修改后的内容中[start, start + insertLength)的部分
+     */
+    class TextEdit {
+    public:
+        size_t start;
+        size_t removeLength;
+        size_t insertLength;
+
+        static TextEdit diff(const std::u16string_view &oldContent, const std::u16string_view &newContent);
+    };
+
     LexerResult lex(const std::u16string &content);
 
+    LexerResult relex(const LexerResult &old, const std::u16string &content, const TextEdit &edit);
+
+    LexerResult relex(const LexerResult &old, const std::u16string &content);
+
 }// namespace CHelper::Lexer
 
 #endif//CHELPER_LEXER_H
@@ -20,8 +20,6 @@ namespace CHelper {
         explicit LexerPos(size_t index = 0,
                           size_t line = 0,
                           size_t col = 0);
-
-        void next(char16_t ch);
     };
 
     std::ostream &operator<<(std::ostream &os, const LexerPos &pos);
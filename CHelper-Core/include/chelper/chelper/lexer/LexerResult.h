@@ -7,6 +7,7 @@
 #ifndef CHELPER_LEXERRESULT_H
 #define CHELPER_LEXERRESULT_H
 
+#include "LexerPos.h"
 #include "Token.h"
 #include "pch.h"
 
@@ -17,7 +18,19 @@ namespace CHelper {
         const std::u16string content;
         const std::vector<Token> allTokens;
 
+    private:
+        //除第一行以外每一行的开始位置，也就是每个换行符的下一个位置，从小到大排列
+        std::vector<size_t> lineStarts;
+
+    public:
         LexerResult(std::u16string content, std::vector<Token> allTokens);
+
+        /**
+         * 获取内容中的某个位置的行号和列号，通过二分查找所在的行
+         *
+         * 行号从0开始。第一行的列号从0开始，其他行的列号从1开始。
+         */
+        [[nodiscard]] LexerPos getPos(size_t index) const;
     };
 
 }// namespace CHelper
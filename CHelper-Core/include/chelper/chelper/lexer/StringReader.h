@@ -7,14 +7,16 @@
 #ifndef CHELPER_STRINGREADER_H
 #define CHELPER_STRINGREADER_H
 
-#include "LexerPos.h"
 #include "pch.h"
 
 namespace CHelper {
 
+    /**
+     * 逐个字符读取字符串，只记录当前字符的下标，需要行号和列号时通过LexerResult::getPos计算
+     */
     class StringReader {
     public:
-        LexerPos pos, posBackup;
+        size_t index = 0, indexBackup = 0;
         const std::u16string &content;
 
         explicit StringReader(const std::u16string &content);
@@ -7,7 +7,6 @@
 #ifndef CHELPER_TOKEN_H
 #define CHELPER_TOKEN_H
 
-#include "LexerPos.h"
 #include <pch.h>
 
 namespace CHelper {
@@ -30,10 +29,11 @@ namespace CHelper {
     class Token {
     public:
         const TokenType::TokenType type;
-        const LexerPos pos;
+        //在内容中的开始位置，行号和列号只在需要时通过LexerResult::getPos计算
+        const size_t index;
         const std::u16string_view content;
 
-        Token(TokenType::TokenType type, LexerPos pos, const std::u16string_view &content);
+        Token(TokenType::TokenType type, size_t index, const std::u16string_view &content);
 
         [[nodiscard]] size_t getStartIndex() const;
 
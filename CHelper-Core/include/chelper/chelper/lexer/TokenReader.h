@@ -40,11 +40,27 @@ namespace CHelper {
 
     }// namespace Node
 
+    class ParseCache;
+
+    class ParseMemo;
+
+    class ParseStats;
+
     class TokenReader {
     public:
         const std::shared_ptr<LexerResult> lexerResult;
         size_t index = 0;
         std::vector<size_t> indexStack;
+        //读取到的最远的token位置，增量解析时用于判断结果是否可以复用
+        size_t maxIndex = 0;
+        //增量解析使用的缓存，为nullptr时不使用增量解析
+        ParseCache *parseCache = nullptr;
+        //一次解析中使用的备忘录，为nullptr时不使用备忘录
+        ParseMemo *parseMemo = nullptr;
+        //解析时的统计数据，为nullptr时不进行统计
+        ParseStats *parseStats = nullptr;
+        //只需要错误原因时为true，OR类型的节点只保留最好的子节点，失败的分支会被立即释放
+        bool isOnlyErrorReasons = false;
 
         explicit TokenReader(const std::shared_ptr<LexerResult> &lexerResult);
 
@@ -58,6 +74,7 @@ namespace CHelper {
 
         bool skip();
 
+        //跳过空格，返回跳过的空格数量，连续的空格是同一个token
         size_t skipWhitespace();
 
         void skipToLF();
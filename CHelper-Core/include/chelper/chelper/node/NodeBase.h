@@ -9,6 +9,7 @@
 
 #include "../lexer/TokenReader.h"
 #include "../parser/ASTNode.h"
+#include "../parser/CommandGenerator.h"
 #include "pch.h"
 
 #define CHELPER_NODE_TYPES BLOCK,             \
@@ -58,6 +59,14 @@
 #define CODEC_NODE_NONE(CodecType) \
     CODEC_NONE_WITH_PARENT(CodecType, CHelper::Node::NodeBase)
 
+//记录节点的getASTNode的运行时间，到当前作用域结束为止
+#ifdef CHelperTrace
+#define CHELPER_TRACE_GET_AST_NODE(node) \
+    CHelper::Trace::Scope chelperTraceGetASTNode(CHelper::Node::getTraceName((node)->getNodeType()))
+#else
+#define CHELPER_TRACE_GET_AST_NODE(node)
+#endif
+
 namespace CHelper {
 
     class CPack;
@@ -72,6 +81,11 @@ namespace CHelper {
 
         constexpr NodeTypeId::NodeTypeId MAX_TYPE_ID = NodeTypeId::SINGLE_SYMBOL;
 
+#ifdef CHelperTrace
+        //记录getASTNode的运行时间时使用的名字，每种节点类型的名字不同
+        const char *getTraceName(NodeTypeId::NodeTypeId id);
+#endif
+
         class NodeBase {
         public:
             std::optional<std::u16string> id;
@@ -100,9 +114,22 @@ namespace CHelper {
             [[nodiscard]] HEDLEY_NON_NULL(3) ASTNode
                     getASTNodeWithNextNode(TokenReader &tokenReader, const CPack *cpack) const;
 
+            /**
+             * 调用节点的getASTNode，同时记录运行时间和解析统计，直接调用其他节点的getASTNode时都通过这个函数
+             */
+            [[nodiscard]] HEDLEY_NON_NULL(1, 3) static ASTNode
+                    dispatchASTNode(const NodeBase *node, TokenReader &tokenReader, const CPack *cpack);
+
             [[nodiscard]] HEDLEY_NON_NULL(3) ASTNode
                     getASTNodeWithNextNode(TokenReader &tokenReader, const CPack *cpack, bool isRequireWhitespace) const;
 
+        private:
+            [[nodiscard]] HEDLEY_NON_NULL(3) ASTNode
+                    getASTNodeWithNextNodeWithoutMemo(TokenReader &tokenReader, const CPack *cpack, bool isRequireWhitespace) const;
+
+            [[nodiscard]] HEDLEY_NON_NULL(3) ASTNode
+                    getASTNodeWithCache(TokenReader &tokenReader, const CPack *cpack) const;
+
         protected:
             HEDLEY_NON_NULL(3, 4)
             ASTNode
@@ -146,6 +173,15 @@ namespace CHelper {
 
             void collectStructureWithNextNodes(StructureBuilder &structure,
                                                bool isMustHave) const;
+
+            /**
+             * 随机生成符合这个节点的内容，不包括下一个节点的内容
+             */
+            virtual void generate(CommandGenerator &generator) const;
+
+            void generateWithNextNodes(CommandGenerator &generator) const;
+
+            void generateWithNextNodes(CommandGenerator &generator, bool isRequireWhitespace) const;
         };
 
     }// namespace Node
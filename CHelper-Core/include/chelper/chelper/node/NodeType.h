@@ -75,7 +75,7 @@ namespace CHelper {
             };
         }// namespace NodeCreateStage
 
-        static NodeCreateStage::NodeCreateStage currentCreateStage;
+        inline thread_local NodeCreateStage::NodeCreateStage currentCreateStage = NodeCreateStage::NONE;
 
         namespace details {
 
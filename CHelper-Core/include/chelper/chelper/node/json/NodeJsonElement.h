@@ -29,6 +29,8 @@ namespace CHelper::Node {
 
         ASTNode getASTNode(TokenReader &tokenReader, const CPack *cpack) const override;
 
+        void generate(CommandGenerator &generator) const override;
+
         static NodeBase *getNodeJsonElement();
     };
 
@@ -15,12 +15,12 @@ namespace CHelper::Node {
 
     class NodeCommand : public NodeBase {
     private:
-        std::vector<std::unique_ptr<NodePerCommand>> *commands = nullptr;
+        const CPack *cpack = nullptr;
 
     public:
         NodeCommand(const std::optional<std::u16string> &id,
                     const std::optional<std::u16string> &description,
-                    std::vector<std::unique_ptr<NodePerCommand>> *commands);
+                    const CPack *cpack);
 
         NodeCommand() = default;
 
@@ -30,6 +30,8 @@ namespace CHelper::Node {
 
         ASTNode getASTNode(TokenReader &tokenReader, const CPack *cpack) const override;
 
+        void generate(CommandGenerator &generator) const override;
+
         std::optional<std::u16string> collectDescription(const ASTNode *node, size_t index) const override;
 
         bool collectSuggestions(const ASTNode *astNode,
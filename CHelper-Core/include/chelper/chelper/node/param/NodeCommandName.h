@@ -14,7 +14,7 @@ namespace CHelper::Node {
 
     class NodeCommandName : public NodeBase {
     private:
-        std::vector<std::unique_ptr<NodePerCommand>> *commands = nullptr;
+        const CPack *cpack = nullptr;
 
     public:
         void init(const CPack &cpack) override;
@@ -23,6 +23,8 @@ namespace CHelper::Node {
 
         ASTNode getASTNode(TokenReader &tokenReader, const CPack *cpack) const override;
 
+        void generate(CommandGenerator &generator) const override;
+
         bool collectIdError(const ASTNode *astNode,
                             std::vector<std::shared_ptr<ErrorReason>> &idErrorReasons) const override;
 
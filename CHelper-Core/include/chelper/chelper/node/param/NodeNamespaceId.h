@@ -8,6 +8,8 @@
 #define CHELPER_NODENAMESPACEID_H
 
 #include "../../resources/CPack.h"
+#include "../../resources/id/IdIndex.h"
+#include "../../resources/id/IdSet.h"
 #include "../../resources/id/NamespaceId.h"
 #include "../NodeBase.h"
 
@@ -21,6 +23,10 @@ namespace CHelper::Node {
 
     private:
         std::shared_ptr<std::vector<std::shared_ptr<NamespaceId>>> customContents;
+        //名字集合，用于判断ID是否存在
+        std::shared_ptr<IdSet> customContentsSet;
+        //搜索索引，用于补全提示
+        std::shared_ptr<NamespaceIdIndex> customContentsIndex;
 
     public:
         NodeNamespaceId() = default;
@@ -36,6 +42,8 @@ namespace CHelper::Node {
 
         ASTNode getASTNode(TokenReader &tokenReader, const CPack *cpack) const override;
 
+        void generate(CommandGenerator &generator) const override;
+
         bool collectIdError(const ASTNode *astNode,
                             std::vector<std::shared_ptr<ErrorReason>> &idErrorReasons) const override;
 
@@ -8,6 +8,8 @@
 #define CHELPER_NODENORMALID_H
 
 #include "../../resources/CPack.h"
+#include "../../resources/id/IdIndex.h"
+#include "../../resources/id/IdSet.h"
 #include "../../resources/id/NormalId.h"
 #include "../NodeBase.h"
 #include "pch.h"
@@ -24,6 +26,10 @@ namespace CHelper::Node {
 
     private:
         std::shared_ptr<std::vector<std::shared_ptr<NormalId>>> customContents;
+        //名字集合，用于判断ID是否存在
+        std::shared_ptr<IdSet> customContentsSet;
+        //搜索索引，用于补全提示
+        std::shared_ptr<NormalIdIndex> customContentsIndex;
 
     public:
         NodeNormalId() = default;
@@ -56,6 +62,8 @@ namespace CHelper::Node {
 
         ASTNode getASTNode(TokenReader &tokenReader, const CPack *cpack) const override;
 
+        void generate(CommandGenerator &generator) const override;
+
         bool collectIdError(const ASTNode *astNode,
                             std::vector<std::shared_ptr<ErrorReason>> &idErrorReasons) const override;
 
@@ -10,6 +10,16 @@
 #include "../NodeBase.h"
 #include "../util/NodeOr.h"
 #include "NodeLF.h"
+#include <mutex>
+
+namespace CHelper::Node {
+
+    class NodePerCommand;
+
+}// namespace CHelper::Node
+
+template<>
+struct serialization::Codec<CHelper::Node::NodePerCommand>;
 
 namespace CHelper::Node {
 
@@ -19,6 +29,20 @@ namespace CHelper::Node {
         std::vector<std::unique_ptr<Node::NodeBase>> nodes;
         std::vector<Node::NodeBase *> startNodes;
 
+    private:
+        // 从内存中读取二进制资源包时，命令的节点在第一次使用时才加载
+        // 持有命令内容所在的内存，为nullptr表示已经加载
+        std::shared_ptr<const void> lazyOwner;
+        // 命令内容（节点、开始节点、节点之间的连接）在二进制资源包中的位置
+        const char *lazyData = nullptr;
+        size_t lazySize = 0;
+        // 加载后用于初始化节点的资源包
+        const CPack *lazyCPack = nullptr;
+        mutable std::once_flag lazyLoadFlag;
+
+        friend struct serialization::Codec<NodePerCommand>;
+
+    public:
         NodePerCommand() = default;
 
         void init(const CPack &cpack) override;
@@ -27,8 +51,16 @@ namespace CHelper::Node {
 
         ASTNode getASTNode(TokenReader &tokenReader, const CPack *cpack) const override;
 
+        void generate(CommandGenerator &generator) const override;
+
         std::optional<std::u16string> collectDescription(const ASTNode *node, size_t index) const override;
 
+        //加载命令的节点，如果已经加载就什么都不做
+        void load() const;
+
+    private:
+        void initNodes(const CPack &cpack);
+
     };// NodePerCommand
 
 }// namespace CHelper::Node
@@ -46,6 +78,7 @@ struct serialization::Codec<CHelper::Node::NodePerCommand> : BaseCodec<CHelper::
     static void to_json(typename JsonValueType::AllocatorType &allocator,
                         JsonValueType &jsonValue,
                         const Type &t) {
+        t.load();
         jsonValue.SetObject();
         //name
         Codec<decltype(t.name)>::template to_json_member<JsonValueType>(allocator, jsonValue, details::JsonKey<Type, typename JsonValueType::Ch>::name_(), t.name);
@@ -175,87 +208,123 @@ struct serialization::Codec<CHelper::Node::NodePerCommand> : BaseCodec<CHelper::
     template<bool isNeedConvert>
     static void to_binary(std::ostream &ostream,
                           const Type &t) {
+        t.load();
         //name
         Codec<decltype(t.name)>::template to_binary<isNeedConvert>(ostream, t.name);
         //description
         Codec<decltype(t.description)>::template to_binary<isNeedConvert>(ostream, t.description);
+        //命令内容的长度，读取时可以跳过命令内容，在第一次使用时再加载
+        std::ostringstream bodyStream;
+        body_to_binary<isNeedConvert>(bodyStream, t);
+        std::string body = std::move(bodyStream).str();
+        Codec<uint32_t>::template to_binary<isNeedConvert>(ostream, static_cast<uint32_t>(body.size()));
+        ostream.write(body.data(), static_cast<std::streamsize>(body.size()));
+    }
+
+    template<bool isNeedConvert>
+    static void from_binary(std::istream &istream,
+                            Type &t) {
+        //name
+        Codec<decltype(t.name)>::template from_binary<isNeedConvert>(istream, t.name);
+        if (HEDLEY_UNLIKELY(t.name.empty())) {
+            throw std::runtime_error("command size cannot be zero");
+        }
+        //description
+        Codec<decltype(t.description)>::template from_binary<isNeedConvert>(istream, t.description);
+        //命令内容
+        uint32_t bodySize = 0;
+        Codec<uint32_t>::template from_binary<isNeedConvert>(istream, bodySize);
+        auto *buffer = dynamic_cast<CHelper::MemoryStreamBuffer *>(istream.rdbuf());
+        if (HEDLEY_LIKELY(isNeedConvert && buffer != nullptr && buffer->getOwner() != nullptr)) {
+            // 损坏或者不完整的资源包中命令内容的长度可能超出剩余的内容
+            if (HEDLEY_UNLIKELY(!istream || bodySize > buffer->getRemaining())) {
+                CHelper::Profile::push("command body size {} is out of range, only {} bytes remain (in command \"{}\")",
+                                       bodySize, buffer->getRemaining(), CHelper::StringUtil::join(u",", t.name));
+                throw std::runtime_error("command body size is out of range");
+            }
+            t.lazyOwner = buffer->getOwner();
+            t.lazyData = buffer->getCurrent();
+            t.lazySize = bodySize;
+            istream.seekg(bodySize, std::ios_base::cur);
+            return;
+        }
+        body_from_binary<isNeedConvert>(istream, t);
+    }
+
+    //二进制资源包中表示换行节点的下标，换行节点不在命令的节点列表中
+    constexpr static uint32_t LF_NODE_INDEX = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * 开始节点和子节点保存为在命令的节点列表中的下标，读取时直接通过下标得到节点，不需要通过节点ID查找
+     *
+     * 节点对ID列表、JSON数据和重复部分的引用仍然保存为键，在命令第一次使用时通过资源包查找一次，不在加载资源包时处理
+     */
+    template<bool isNeedConvert>
+    static void body_to_binary(std::ostream &ostream,
+                               const Type &t) {
         //node
         Codec<decltype(t.nodes)>::template to_binary<isNeedConvert>(ostream, t.nodes);
+        std::unordered_map<const CHelper::Node::NodeBase *, uint32_t> nodeIndexes;
+        nodeIndexes.reserve(t.nodes.size());
+        for (size_t i = 0; i < t.nodes.size(); ++i) {
+            nodeIndexes.emplace(t.nodes[i].get(), static_cast<uint32_t>(i));
+        }
+        auto getNodeIndex = [&t, &nodeIndexes](const CHelper::Node::NodeBase *node) -> uint32_t {
+            if (HEDLEY_UNLIKELY(node == CHelper::Node::NodeLF::getInstance())) {
+                return LF_NODE_INDEX;
+            }
+            auto it = nodeIndexes.find(node);
+            if (HEDLEY_UNLIKELY(it == nodeIndexes.end())) {
+                CHelper::Profile::push(R"(node is not in the command -> {} (in command "{}"))", node->id.value_or(u"UNKNOWN"), CHelper::StringUtil::join(u",", t.name));
+                throw std::runtime_error("node is not in the command");
+            }
+            return it->second;
+        };
         //start
         Codec<uint32_t>::template to_binary<isNeedConvert>(ostream, t.startNodes.size());
         for (const auto &item: t.startNodes) {
-            Codec<std::u16string>::template to_binary<isNeedConvert>(ostream, item->id.value());
+            Codec<uint32_t>::template to_binary<isNeedConvert>(ostream, getNodeIndex(item));
         }
         //ast
         for (const auto &item: t.nodes) {
             Codec<uint32_t>::template to_binary<isNeedConvert>(ostream, item->nextNodes.size());
             for (const auto &item2: item->nextNodes) {
-                Codec<std::u16string>::template to_binary<isNeedConvert>(ostream, item2->id.value());
+                Codec<uint32_t>::template to_binary<isNeedConvert>(ostream, getNodeIndex(item2));
             }
         }
     }
 
     template<bool isNeedConvert>
-    static void from_binary(std::istream &istream,
-                            Type &t) {
-        //name
-        Codec<decltype(t.name)>::template from_binary<isNeedConvert>(istream, t.name);
-        if (HEDLEY_UNLIKELY(t.name.empty())) {
-            throw std::runtime_error("command size cannot be zero");
-        }
-        //description
-        Codec<decltype(t.description)>::template from_binary<isNeedConvert>(istream, t.description);
+    static void body_from_binary(std::istream &istream,
+                                 Type &t) {
         //node
         Codec<decltype(t.nodes)>::template from_binary<isNeedConvert>(istream, t.nodes);
-        //start
-        uint32_t startNodeIdSize;
-        Codec<uint32_t>::template from_binary<isNeedConvert>(istream, startNodeIdSize);
-        t.startNodes.reserve(startNodeIdSize);
-        for (int i = 0; i < startNodeIdSize; ++i) {
-            std::u16string startNodeId;
-            Codec<decltype(startNodeId)>::template from_binary<isNeedConvert>(istream, startNodeId);
-            if (HEDLEY_UNLIKELY(startNodeId == u"LF")) {
-                t.startNodes.push_back(CHelper::Node::NodeLF::getInstance());
-                continue;
+        auto readNode = [&istream, &t]() -> CHelper::Node::NodeBase * {
+            uint32_t index;
+            Codec<uint32_t>::template from_binary<isNeedConvert>(istream, index);
+            if (HEDLEY_UNLIKELY(index == LF_NODE_INDEX)) {
+                return CHelper::Node::NodeLF::getInstance();
             }
-            bool flag = true;
-            for (auto &node: t.nodes) {
-                if (HEDLEY_UNLIKELY(node->id == startNodeId)) {
-                    t.startNodes.push_back(node.get());
-                    flag = false;
-                    break;
-                }
-            }
-            if (HEDLEY_UNLIKELY(flag)) {
-                CHelper::Profile::push(R"("unknown node id -> {} (in command "{}"))", startNodeId, CHelper::StringUtil::join(u",", t.name));
-                throw std::runtime_error("unknown node id");
+            if (HEDLEY_UNLIKELY(index >= t.nodes.size())) {
+                CHelper::Profile::push(R"(node index out of range -> {} (in command "{}"))", index, CHelper::StringUtil::join(u",", t.name));
+                throw std::runtime_error("node index out of range");
             }
+            return t.nodes[index].get();
+        };
+        //start
+        uint32_t startNodeSize;
+        Codec<uint32_t>::template from_binary<isNeedConvert>(istream, startNodeSize);
+        t.startNodes.reserve(startNodeSize);
+        for (uint32_t i = 0; i < startNodeSize; ++i) {
+            t.startNodes.push_back(readNode());
         }
         //ast
         for (const auto &node: t.nodes) {
-            CHelper::Node::NodeBase *parentNode = node.get();
             uint32_t childNodeSize;
             Codec<uint32_t>::template from_binary<isNeedConvert>(istream, childNodeSize);
-            parentNode->nextNodes.reserve(childNodeSize);
-            for (int j = 0; j < childNodeSize; ++j) {
-                std::u16string childNodeId;
-                Codec<decltype(childNodeId)>::template from_binary<isNeedConvert>(istream, childNodeId);
-                if (HEDLEY_UNLIKELY(childNodeId == u"LF")) {
-                    parentNode->nextNodes.push_back(CHelper::Node::NodeLF::getInstance());
-                    continue;
-                }
-                CHelper::Node::NodeBase *childNode = nullptr;
-                for (auto &node1: t.nodes) {
-                    if (HEDLEY_UNLIKELY(node1->id == childNodeId)) {
-                        childNode = node1.get();
-                        break;
-                    }
-                }
-                if (HEDLEY_UNLIKELY(childNode == nullptr)) {
-                    CHelper::Profile::push(R"("unknown node id -> {} (in command "{}"))", childNodeId, CHelper::StringUtil::join(u",", t.name));
-                    throw std::runtime_error("unknown node id");
-                }
-                parentNode->nextNodes.push_back(childNode);
+            node->nextNodes.reserve(childNodeSize);
+            for (uint32_t j = 0; j < childNodeSize; ++j) {
+                node->nextNodes.push_back(readNode());
             }
         }
     }
@@ -30,6 +30,8 @@ namespace CHelper::Node {
 
         ASTNode getASTNode(TokenReader &tokenReader, const CPack *cpack) const override;
 
+        void generate(CommandGenerator &generator) const override;
+
         std::optional<std::u16string> collectDescription(const ASTNode *node, size_t index) const override;
 
         void collectStructure(const ASTNode *astNode,
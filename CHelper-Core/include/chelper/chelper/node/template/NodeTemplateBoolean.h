@@ -62,6 +62,10 @@ namespace CHelper::Node {
             structure.append(isMustHave, description.value_or(u"布尔值"));
         }
 
+        void generate(CommandGenerator &generator) const override {
+            generator.append(generator.nextBoolean() ? u"true" : u"false");
+        }
+
         bool collectColor(const ASTNode *astNode,
                           ColoredString &coloredString,
                           const Theme &theme) const override {
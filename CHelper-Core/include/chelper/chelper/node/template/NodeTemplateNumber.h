@@ -84,6 +84,19 @@ namespace CHelper::Node {
             structure.append(isMustHave, description.value_or(u"数字"));
         }
 
+        void generate(CommandGenerator &generator) const override {
+            // 没有范围限制时只生成较小的数字
+            if constexpr (std::numeric_limits<T>::is_integer) {
+                int64_t minValue = min.has_value() ? min.value() : (max.has_value() ? max.value() - 100 : -100);
+                int64_t maxValue = max.has_value() ? max.value() : minValue + 200;
+                generator.appendInteger(minValue, maxValue);
+            } else {
+                double minValue = min.has_value() ? min.value() : (max.has_value() ? max.value() - 100 : -100);
+                double maxValue = max.has_value() ? max.value() : minValue + 200;
+                generator.appendFloat(minValue, maxValue);
+            }
+        }
+
         bool collectColor(const ASTNode *astNode,
                           ColoredString &coloredString,
                           const Theme &theme) const override {
@@ -10,9 +10,6 @@
 namespace CHelper::Node {
 
     class NodeAny : public NodeBase {
-    private:
-        std::unique_ptr<NodeBase> node;
-
     public:
         NodeAny() = default;
 
@@ -23,10 +20,10 @@ namespace CHelper::Node {
     public:
         [[nodiscard]] NodeTypeId::NodeTypeId getNodeType() const override;
 
-        void init(const CPack &cpack) override;
-
         ASTNode getASTNode(TokenReader &tokenReader, const CPack *cpack) const override;
 
+        void generate(CommandGenerator &generator) const override;
+
         static NodeAny *getNodeAny();
     };
 
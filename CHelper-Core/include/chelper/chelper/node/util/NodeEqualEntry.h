@@ -40,6 +40,8 @@ namespace CHelper::Node {
         [[nodiscard]] NodeTypeId::NodeTypeId getNodeType() const override;
 
         ASTNode getASTNode(TokenReader &tokenReader, const CPack *cpack) const override;
+
+        void generate(CommandGenerator &generator) const override;
     };
 
 }// namespace CHelper::Node
@@ -25,6 +25,8 @@ namespace CHelper {
 
     }// namespace Node
 
+    class CursorIndex;
+
     namespace ASTNodeMode {
         enum ASTNodeMode : uint8_t {
             //没有向下的分支
@@ -71,12 +73,14 @@ namespace CHelper {
         std::vector<std::shared_ptr<ErrorReason>> errorReasons;
         //哪个节点最好，OR类型特有，获取颜色和生成命令格式文本的时候使用
         size_t whichBest;
+        //词法分析结果，只有解析结果的根节点持有，其他节点为nullptr，其他节点不能比根节点活得更久
+        std::shared_ptr<LexerResult> lexerResult;
 
         ASTNode(ASTNodeMode::ASTNodeMode mode,
                 const Node::NodeBase *node,
                 std::vector<ASTNode> &&childNodes,
                 TokensView tokens,
-                const std::vector<std::shared_ptr<ErrorReason>> &errorReasons,
+                std::vector<std::shared_ptr<ErrorReason>> errorReasons,
                 ASTNodeId::ASTNodeId id,
                 size_t whichBest = -1);
 
@@ -90,6 +94,20 @@ namespace CHelper {
         [[nodiscard]]json toBestJson() const;
 #endif
 
+        /**
+         * 把子节点移动到vector中
+         *
+         * 使用初始化列表构造vector时，初始化列表中的元素是const的，每个子节点都会被复制一次，
+         * 子节点又包含了它所有的子节点，所以会产生大量的内存分配
+         */
+        template<class... ASTNodes>
+        static std::vector<ASTNode> makeChildNodes(ASTNodes &&...astNodes) {
+            std::vector<ASTNode> result;
+            result.reserve(sizeof...(astNodes));
+            (result.push_back(std::forward<ASTNodes>(astNodes)), ...);
+            return result;
+        }
+
         static ASTNode simpleNode(const Node::NodeBase *node,
                                   const TokensView &tokens,
                                   const std::shared_ptr<ErrorReason> &errorReason = nullptr,
@@ -126,6 +144,13 @@ namespace CHelper {
 
         [[nodiscard]] bool isAllWhitespaceError() const;
 
+        /**
+         * OR类型的节点只保留最好的子节点
+         *
+         * 错误原因和ID错误只来自最好的子节点，其他子节点只在获取补全提示时使用
+         */
+        void dropLosingChildNodes();
+
         [[nodiscard]] const ASTNode &getBestNode() const {
             return childNodes[whichBest];
         }
@@ -140,13 +165,21 @@ namespace CHelper {
 
         void collectColor(ColoredString &coloredString, const Theme &theme) const;
 
-        [[nodiscard]] std::u16string getDescription(size_t index) const;
+        /**
+         * @param cursorIndex 这个节点的光标索引，不为nullptr时从覆盖光标位置的节点开始获取，不需要从根节点遍历
+         */
+        [[nodiscard]] std::u16string getDescription(size_t index, const CursorIndex *cursorIndex = nullptr) const;
 
         [[nodiscard]] std::vector<std::shared_ptr<ErrorReason>> getIdErrors() const;
 
         [[nodiscard]] std::vector<std::shared_ptr<ErrorReason>> getErrorReasons() const;
 
-        [[nodiscard]] std::vector<Suggestion> getSuggestions(size_t index) const;
+        /**
+         * 只过滤和排序每一组补全提示，获取补全提示时才会创建，适合只需要显示一部分补全提示的情况
+         */
+        [[nodiscard]] SuggestionList getSuggestionList(size_t index, const CursorIndex *cursorIndex = nullptr) const;
+
+        [[nodiscard]] std::vector<Suggestion> getSuggestions(size_t index, const CursorIndex *cursorIndex = nullptr) const;
 
         [[nodiscard]] std::u16string getStructure() const;
 
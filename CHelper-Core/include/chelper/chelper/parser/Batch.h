@@ -0,0 +1,38 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_BATCH_H
+#define CHELPER_BATCH_H
+
+#include "../resources/CPack.h"
+#include "ErrorReason.h"
+#include "pch.h"
+
+/**
+ * 批量检查命令，用于检查整个函数文件
+ */
+namespace CHelper::Batch {
+
+    /**
+     * 按LF把文本分成多行，行末的CR会被去掉，返回的内容引用传入的文本
+     */
+    std::vector<std::u16string_view> splitLines(const std::u16string_view &content);
+
+    /**
+     * 在多个线程中同时检查多行命令，只计算错误原因，不计算补全提示、结构和颜色
+     *
+     * @param cpack 资源包，所有线程共用
+     * @param lines 每一行命令，空行和以#开头的注释行没有错误
+     * @param threads 线程数量，为0时使用硬件支持的并发线程数量
+     * @return 每一行命令的错误原因，顺序和传入的命令相同，错误的位置相对于这一行的开头
+     */
+    std::vector<std::vector<std::shared_ptr<ErrorReason>>> validate(const CPack &cpack,
+                                                                    const std::vector<std::u16string_view> &lines,
+                                                                    size_t threads = 0);
+
+}// namespace CHelper::Batch
+
+#endif//CHELPER_BATCH_H
@@ -0,0 +1,107 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_COMMANDGENERATOR_H
+#define CHELPER_COMMANDGENERATOR_H
+
+#include "pch.h"
+#include <random>
+
+namespace CHelper {
+
+    class CPack;
+
+    namespace Node {
+        class NodeBase;
+    }// namespace Node
+
+    /**
+     * 根据资源包的节点随机生成命令，用于测试和性能测试
+     *
+     * 每个节点的generate方法生成符合这个节点的内容，再随机选择一个下一个节点继续生成。
+     * 随机数只使用std::mt19937的输出，不使用标准库的分布，所以在不同平台上相同的随机种子生成的命令相同。
+     */
+    class CommandGenerator {
+    public:
+        //超过这个深度后，节点会尽量选择更短的内容，比如直接结束命令、列表不添加元素
+        static constexpr size_t SOFT_MAX_DEPTH = 48;
+        //超过这个深度或者长度后放弃生成这条命令
+        static constexpr size_t HARD_MAX_DEPTH = 256;
+        static constexpr size_t MAX_LENGTH = 2048;
+
+        //正在生成的命令
+        std::u16string result;
+
+    private:
+        std::mt19937 random;
+        size_t depth = 0;
+        bool isFailed = false;
+
+    public:
+        explicit CommandGenerator(uint32_t seed);
+
+        /**
+         * 生成一条命令，节点无法生成时返回std::nullopt，生成的命令不一定没有错误
+         */
+        std::optional<std::u16string> generate(const CPack &cpack);
+
+        /**
+         * 进入一个节点，深度或者长度超出限制时返回false，不需要调用pop
+         */
+        bool push();
+
+        void pop();
+
+        //节点无法生成内容时调用，这条命令会被丢弃
+        void fail();
+
+        [[nodiscard]] bool isTooDeep() const;
+
+        //返回[0, size)中的一个数
+        size_t nextIndex(size_t size);
+
+        bool nextBoolean(uint32_t percent = 50);
+
+        template<class T>
+        const T &nextElement(const std::vector<T> &elements) {
+            return elements[nextIndex(elements.size())];
+        }
+
+        //选择下一个节点，深度超出SOFT_MAX_DEPTH时优先结束命令
+        const Node::NodeBase *nextNode(const std::vector<Node::NodeBase *> &nextNodes);
+
+        void append(char16_t ch);
+
+        void append(const std::u16string_view &str);
+
+        void appendInteger(int64_t min, int64_t max);
+
+        void appendFloat(double min, double max);
+
+        //只包含小写字母的单词
+        void appendWord();
+    };
+
+    /**
+     * 随机生成的测试命令
+     */
+    struct GeneratedCommands {
+        //没有错误的命令
+        std::vector<std::u16string> valid;
+        //从没有错误的命令修改得到，被截断或者有一个字符错误，修改后不一定有错误
+        std::vector<std::u16string> nearValid;
+    };
+
+    /**
+     * 随机生成测试命令，相同的资源包和随机种子生成的命令相同
+     *
+     * 生成的命令使用Parser::validate过滤，只保留没有错误的命令，多次生成失败时返回的命令数量可能少于要求的数量
+     */
+    GeneratedCommands generateCommands(const CPack &cpack, size_t validCount, size_t nearValidCount, uint32_t seed);
+
+}// namespace CHelper
+
+#endif//CHELPER_COMMANDGENERATOR_H
@@ -0,0 +1,66 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_CURSORINDEX_H
+#define CHELPER_CURSORINDEX_H
+
+#include "ASTNode.h"
+#include "pch.h"
+
+namespace CHelper {
+
+    /**
+     * 光标位置到覆盖这个位置的AST节点的索引
+     *
+     * 从根节点获取说明和补全提示时，每一层都要检查子节点是否覆盖光标位置，AND类型的节点要逐个检查子节点，
+     * 获取补全提示时OR类型的节点还要检查所有子节点。内容没有改变时，只移动光标也会从根节点重新遍历。
+     *
+     * 一个节点被访问的条件是光标位置在它和它所有父节点的范围内，也就是在这些范围的交集内，所以每个节点只对应一个区间。
+     * 把所有区间的端点排序后，端点和相邻端点之间的位置把光标位置分为若干段，同一段中被访问的节点是相同的。
+     * 构建时按先序遍历的顺序把节点加入它覆盖的每一段，查询时二分查找光标所在的段，再按顺序访问这一段中的节点，
+     * 访问的顺序和从根节点遍历的顺序相同，所以得到的结果也相同。
+     *
+     * 索引中保存的是节点的指针，不能比构建它的AST节点活得更久。
+     */
+    class CursorIndex {
+    private:
+        class Entry {
+        public:
+            const ASTNode *astNode;
+            //先序遍历中这个节点的子树结束的位置，节点要求跳过子节点时使用
+            uint32_t subtreeEnd;
+            //从根节点到这个节点经过的OR类型节点都选择了最好的子节点，获取说明时只访问这些节点
+            bool isBest;
+        };
+
+        std::vector<Entry> entries;
+        //所有区间的端点，从小到大排列
+        std::vector<size_t> bounds;
+        //每一段中的节点在entries中的下标，按先序遍历的顺序排列
+        std::vector<std::vector<uint32_t>> segments;
+
+    public:
+        explicit CursorIndex(const ASTNode &astNode);
+
+        [[nodiscard]] std::optional<std::u16string> collectDescription(size_t index) const;
+
+        void collectSuggestions(size_t index, std::vector<Suggestions> &suggestions) const;
+
+        [[nodiscard]] size_t getEntryCount() const;
+
+    private:
+        void build(const ASTNode &astNode, size_t start, size_t end, bool isBest,
+                   std::vector<std::pair<size_t, size_t>> &ranges);
+
+        /**
+         * 第2k+1段为bounds[k]这个位置，第2k段为bounds[k - 1]和bounds[k]之间的位置
+         */
+        [[nodiscard]] size_t getSegmentIndex(size_t index) const;
+    };
+
+}// namespace CHelper
+
+#endif//CHELPER_CURSORINDEX_H
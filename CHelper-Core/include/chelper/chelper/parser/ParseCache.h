@@ -0,0 +1,83 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_PARSECACHE_H
+#define CHELPER_PARSECACHE_H
+
+#include "../lexer/LexerResult.h"
+#include "ASTNode.h"
+#include "pch.h"
+
+namespace CHelper {
+
+    namespace Node {
+
+        class NodeBase;
+
+    }// namespace Node
+
+    /**
+     * 增量解析使用的缓存
+     *
+     * 每次解析时记录每个节点在某个token位置调用getASTNode的结果，以及这次调用读取到的最远的token位置。
+     * 下一次解析时，如果这次调用读取到的token都在第一个被修改的token之前，就可以直接复用上一次的结果。
+     */
+    class ParseCache {
+    public:
+        class Item {
+        public:
+            const Node::NodeBase *node;
+            //调用getASTNode前的token位置
+            size_t start;
+            //调用getASTNode后的token位置
+            size_t end;
+            //调用getASTNode时读取到的最远的token位置
+            size_t maxIndex;
+            //上一次解析得到的AST节点，指向上一次解析的AST
+            const ASTNode *astNode = nullptr;
+        };
+
+        //节点和调用getASTNode前的token位置
+        using Key = std::pair<const Node::NodeBase *, size_t>;
+
+        class KeyHash {
+        public:
+            size_t operator()(const Key &key) const {
+                return std::hash<const Node::NodeBase *>{}(key.first) * 31 + key.second;
+            }
+        };
+
+    private:
+        //上一次解析的词法分析结果
+        std::shared_ptr<LexerResult> lastLexerResult;
+        //上一次解析可以复用的结果
+        std::unordered_map<Key, Item, KeyHash> lastItems;
+        //本次解析记录的结果
+        std::vector<Item> items;
+        //本次解析的词法分析结果
+        std::shared_ptr<LexerResult> lexerResult;
+        //第一个被修改的token位置，在这之前的token都没有变化
+        size_t firstChangedToken = 0;
+
+    public:
+        [[nodiscard]] const std::shared_ptr<LexerResult> &getLastLexerResult() const;
+
+        void begin(const std::shared_ptr<LexerResult> &lexerResult0);
+
+        [[nodiscard]] const Item *find(const Node::NodeBase *node, size_t start) const;
+
+        void record(const Node::NodeBase *node, size_t start, size_t end, size_t maxIndex);
+
+        [[nodiscard]] ASTNode copy(const Item &item) const;
+
+        void attach(const ASTNode &astNode);
+
+        void clear();
+    };
+
+}// namespace CHelper
+
+#endif//CHELPER_PARSECACHE_H
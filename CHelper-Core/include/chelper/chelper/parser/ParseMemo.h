@@ -0,0 +1,78 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_PARSEMEMO_H
+#define CHELPER_PARSEMEMO_H
+
+#include "ASTNode.h"
+#include "pch.h"
+
+namespace CHelper {
+
+    namespace Node {
+
+        class NodeBase;
+
+    }// namespace Node
+
+    /**
+     * 一次解析中使用的备忘录（packrat）
+     *
+     * 同一个节点可能会在同一个位置被多次解析，例如多个分支的下一个节点是同一个节点。
+     * 在同一次解析中，节点在同一个位置的解析结果是相同的，所以可以直接复用第一次解析的结果。
+     */
+    class ParseMemo {
+    public:
+        class Key {
+        public:
+            const Node::NodeBase *node;
+            //调用getASTNodeWithNextNode前的token位置
+            size_t start;
+            bool isRequireWhitespace;
+
+            bool operator==(const Key &key) const {
+                return node == key.node && start == key.start && isRequireWhitespace == key.isRequireWhitespace;
+            }
+        };
+
+        class KeyHash {
+        public:
+            size_t operator()(const Key &key) const {
+                return (std::hash<const Node::NodeBase *>{}(key.node) * 31 + key.start) * 2 + key.isRequireWhitespace;
+            }
+        };
+
+        class Item {
+        public:
+            //调用getASTNodeWithNextNode后的token位置
+            size_t end;
+            //调用getASTNodeWithNextNode时读取到的最远的token位置
+            size_t maxIndex;
+            ASTNode astNode;
+        };
+
+    private:
+        std::unordered_map<Key, Item, KeyHash> items;
+
+    public:
+        //false-只统计节点的解析次数，不缓存结果
+        const bool isEnableCache;
+        //真正进行解析的次数
+        size_t visitCount = 0;
+        //复用解析结果的次数
+        size_t hitCount = 0;
+
+        explicit ParseMemo(bool isEnableCache = true);
+
+        [[nodiscard]] const Item *find(const Node::NodeBase *node, size_t start, bool isRequireWhitespace);
+
+        void save(const Node::NodeBase *node, size_t start, bool isRequireWhitespace,
+                  size_t end, size_t maxIndex, const ASTNode &astNode);
+    };
+
+}// namespace CHelper
+
+#endif//CHELPER_PARSEMEMO_H
@@ -0,0 +1,42 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_PARSESTATS_H
+#define CHELPER_PARSESTATS_H
+
+#include "../node/NodeBase.h"
+#include "pch.h"
+
+namespace CHelper {
+
+    /**
+     * 解析时的统计数据，用于找到哪些语法结构导致了大量的回溯
+     *
+     * 统计只是几次整数加法，TokenReader::parseStats为nullptr时不进行统计
+     */
+    class ParseStats {
+    public:
+        //每种节点调用getASTNode的次数，增量解析时复用的节点不计算在内
+        std::array<size_t, Node::MAX_TYPE_ID + 1> getASTNodeCounts{};
+        //回溯时重新读取的token数量，也就是调用TokenReader::restore时指针后退的距离
+        size_t backtrackTokens = 0;
+
+        void clear();
+
+        ParseStats &operator+=(const ParseStats &parseStats);
+
+        [[nodiscard]] size_t getASTNodeCount() const;
+
+        static void onGetASTNode(const TokenReader &tokenReader, const Node::NodeBase *node) {
+            if (HEDLEY_UNLIKELY(tokenReader.parseStats != nullptr)) {
+                tokenReader.parseStats->getASTNodeCounts[node->getNodeType()]++;
+            }
+        }
+    };
+
+}// namespace CHelper
+
+#endif//CHELPER_PARSESTATS_H
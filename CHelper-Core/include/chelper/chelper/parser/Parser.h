@@ -13,6 +13,9 @@
 #include "../node/param/NodeCommand.h"
 #include "../resources/CPack.h"
 #include "ASTNode.h"
+#include "ParseCache.h"
+#include "ParseMemo.h"
+#include "ParseStats.h"
 #include "pch.h"
 
 namespace CHelper::Parser {
@@ -21,6 +24,31 @@ namespace CHelper::Parser {
 
     ASTNode parse(const std::u16string &content, const CPack *cpack);
 
+    /**
+     * 使用备忘录进行解析，同一个节点在同一个位置只会解析一次
+     */
+    ASTNode parse(const std::u16string &content, const CPack *cpack, ParseMemo &parseMemo);
+
+    /**
+     * 解析的同时统计每种节点的解析次数和回溯的token数量，统计结果会累加到parseStats中
+     */
+    ASTNode parse(const std::u16string &content, const CPack *cpack, ParseStats &parseStats);
+
+    /**
+     * 增量解析，复用上一次解析中没有受到修改影响的结果
+     *
+     * 解析结束后需要调用parseCache.attach()，传入保存下来的AST
+     */
+    ASTNode parse(const std::u16string &content, const CPack *cpack, ParseCache &parseCache,
+                  ParseMemo *parseMemo = nullptr, ParseStats *parseStats = nullptr);
+
+    /**
+     * 只获取错误原因，结果和parse(content, cpack).getErrorReasons()相同
+     *
+     * 解析时失败的分支会被立即释放，不能用于获取补全提示、结构和颜色，所以不返回语法树
+     */
+    std::vector<std::shared_ptr<ErrorReason>> validate(const std::u16string &content, const CPack *cpack);
+
 }// namespace CHelper::Parser
 
 #endif//CHELPER_PARSER_H
@@ -27,22 +27,33 @@ namespace CHelper {
     class Suggestions {
     public:
         SuggestionsType::SuggestionsType suggestionsType;
+        //延迟生成的补全提示不在这里
         std::vector<Suggestion> suggestions;
 
     private:
+        bool mIsFiltered = false;
         std::optional<size_t> mHashCode;
+        //延迟生成的补全提示，ID的数量可能有几千个，但是界面上只会显示其中的一部分，所以只在需要的时候才创建Suggestion
+        size_t lazyStart = 0, lazyEnd = 0, lazySize = 0;
+        bool lazyIsAddWhitespace = false;
+        std::function<std::shared_ptr<NormalId>(size_t)> getLazyContent;
 
     public:
         explicit Suggestions(SuggestionsType::SuggestionsType suggestionsType);
 
         bool isFiltered();
 
+        //第一次获取时才计算
         size_t hashCode();
 
         void markFiltered();
 
         void filter();
 
+        [[nodiscard]] size_t size() const;
+
+        [[nodiscard]] Suggestion at(size_t which) const;
+
         static Suggestions singleSuggestion(SuggestionsType::SuggestionsType suggestionsType, Suggestion suggestion);
 
         static Suggestions singleWhitespaceSuggestion(Suggestion suggestion);
@@ -51,9 +62,48 @@ namespace CHelper {
 
         static Suggestions singleLiteralSuggestion(Suggestion suggestion);
 
+        /**
+         * 延迟生成的ID补全提示，已经标记为过滤过
+         *
+         * @param getContent 获取第which个补全提示的内容，获取补全提示时才会调用
+         */
+        static Suggestions lazyIdSuggestions(size_t start, size_t end, bool isAddWhitespace, size_t size,
+                                             std::function<std::shared_ptr<NormalId>(size_t)> getContent);
+
         static std::vector<Suggestion> filter(std::vector<Suggestions> &suggestions);
     };
 
+    /**
+     * 过滤并排序后的补全提示
+     *
+     * 只对每一组补全提示去重和排序，不会创建组中的补全提示，获取某一段补全提示时才创建这一段。
+     * 每一组的开始位置是记录下来的，所以分页获取时可以直接从上一页结束的位置继续，不需要重新计算。
+     */
+    class SuggestionList {
+    private:
+        //去重后按优先级排列的每一组补全提示
+        std::vector<Suggestions> groups;
+        //每一组第一个补全提示的位置
+        std::vector<size_t> groupStarts;
+        size_t count = 0;
+
+    public:
+        SuggestionList() = default;
+
+        explicit SuggestionList(std::vector<Suggestions> suggestions);
+
+        [[nodiscard]] size_t size() const;
+
+        [[nodiscard]] Suggestion at(size_t which) const;
+
+        /**
+         * 获取[offset, offset + limit)中的补全提示，超出范围的部分会被忽略
+         */
+        [[nodiscard]] std::vector<Suggestion> get(size_t offset, size_t limit) const;
+
+        [[nodiscard]] std::vector<Suggestion> getAll() const;
+    };
+
 }// namespace CHelper
 
 #endif//CHELPER_SUGGESTIONS_H
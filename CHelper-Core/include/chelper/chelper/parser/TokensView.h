@@ -13,17 +13,18 @@
 
 namespace CHelper {
 
+    /**
+     * 词法分析结果中的一段token
+     *
+     * 不持有词法分析结果，词法分析结果由解析结果的根节点持有（ASTNode::lexerResult），
+     * 所以复制的时候不需要修改引用计数
+     */
     class TokensView {
     public:
-        std::shared_ptr<LexerResult> lexerResult;
+        const LexerResult *lexerResult;
         size_t start, end;
-        size_t startIndex, endIndex;
 
-    private:
-        std::u16string_view cacheString;
-
-    public:
-        TokensView(const std::shared_ptr<LexerResult> &lexerResult, size_t start, size_t end);
+        TokensView(const LexerResult *lexerResult, size_t start, size_t end);
 
         [[nodiscard]] bool isEmpty() const;
 
@@ -46,6 +47,8 @@ namespace CHelper {
         [[nodiscard]] std::u16string_view toString() const;
     };
 
+    static_assert(std::is_trivially_copyable_v<TokensView>, "TokensView should be trivially copyable");
+
 }// namespace CHelper
 
 #endif
\ No newline at end of file
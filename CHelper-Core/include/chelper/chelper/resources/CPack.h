@@ -10,8 +10,11 @@
 #include "../node/json/NodeJsonElement.h"
 #include "../node/param/NodeCommand.h"
 #include "../node/param/NodePerCommand.h"
+#include "LazySection.h"
 #include "Manifest.h"
 #include "id/BlockId.h"
+#include "id/IdIndex.h"
+#include "id/IdSet.h"
 #include "id/ItemId.h"
 #include "pch.h"
 
@@ -25,21 +28,63 @@ namespace CHelper {
         std::vector<bool> isEnd;
     };
 
+    /**
+     * 资源包
+     *
+     * 创建完成后，资源包和它的节点不会再被修改，可以在多个线程中同时调用Parser::parse。
+     * 解析时的状态都保存在TokenReader和ASTNode中，Profile的栈和节点的创建阶段是线程局部变量。
+     * 解析时才创建的内容（延迟加载的命令、ID和JSON数据、ID列表的搜索索引）都有同步保护。
+     *
+     * 从有持有者的内存中读取二进制资源包时，ID、ID列表的名字集合、JSON数据和重复部分在第一次通过get函数使用时才读取和初始化，
+     * 加载时只读取清单和命令的名字和介绍，所以加载资源包的时间不受这些数据大小的影响。
+     * 直接使用这些成员变量前需要先调用loadSections。
+     */
     class CPack {
     public:
+        //二进制资源包开头的标识，为"CHPK"
+        static constexpr uint32_t BINARY_MAGIC = 0x4B504843;
+        //二进制资源包的格式版本，格式改变后需要增加版本号，读取时版本号不同会加载失败
+        static constexpr uint32_t BINARY_FORMAT_VERSION = 2;
+
         Manifest manifest;
         std::unordered_map<std::u16string, std::shared_ptr<std::vector<std::shared_ptr<NormalId>>>> normalIds;
         std::unordered_map<std::u16string, std::shared_ptr<std::vector<std::shared_ptr<NamespaceId>>>> namespaceIds;
         std::shared_ptr<BlockIds> blockIds;
         std::shared_ptr<std::vector<std::shared_ptr<ItemId>>> itemIds;
+        //ID列表的名字集合，会写入二进制资源包，缺少的在afterApply中创建，方块ID和物品ID的键为blocks和items
+        std::unordered_map<std::u16string, std::shared_ptr<IdSet>> normalIdSets;
+        std::unordered_map<std::u16string, std::shared_ptr<IdSet>> namespaceIdSets;
         std::vector<std::unique_ptr<Node::NodeJsonElement>> jsonNodes;
         std::vector<RepeatData> repeatNodeData;
-        std::unordered_map<std::u16string, std::pair<const RepeatData *, const Node::NodeBase *>> repeatNodes;
         std::shared_ptr<std::vector<std::unique_ptr<Node::NodePerCommand>>> commands = std::make_shared<std::vector<std::unique_ptr<Node::NodePerCommand>>>();
         std::unique_ptr<Node::NodeCommand> mainNode;
 
     private:
+        //第一次使用时才读取和初始化的内容，不是从内存中读取的资源包在afterApply中初始化
+        mutable LazySection idSection;
+        mutable LazySection itemIdSection;
+        mutable LazySection blockIdSection;
+        mutable LazySection idSetSection;
+        mutable LazySection jsonSection;
+        mutable LazySection jsonInitSection;
+        mutable LazySection repeatSection;
+        std::unordered_map<std::u16string, std::pair<const RepeatData *, const Node::NodeBase *>> repeatNodes;
         std::vector<std::unique_ptr<Node::NodeBase>> repeatCacheNodes;
+        //ID列表的搜索索引，和ID一起初始化，使用同一个ID列表的节点共用一个索引
+        std::unordered_map<std::u16string, std::shared_ptr<NormalIdIndex>> normalIdIndexes;
+        std::unordered_map<std::u16string, std::shared_ptr<NamespaceIdIndex>> namespaceIdIndexes;
+        //方块ID和物品ID的搜索索引，分别和方块ID、物品ID一起初始化
+        std::shared_ptr<NamespaceIdIndex> blockIdIndex;
+        std::shared_ptr<NamespaceIdIndex> itemIdIndex;
+        //JSON数据的ID到JSON数据的映射，和JSON数据一起初始化，字符串指向JSON数据的ID
+        std::unordered_map<std::u16string_view, const Node::NodeJsonElement *> jsonNodeIds;
+        //命令名字到命令的映射，在afterApply中创建，字符串指向命令中的名字
+        std::unordered_map<std::u16string_view, const Node::NodePerCommand *> commandNames;
+        //所有命令名字，按名字排序，用于补全提示
+        std::shared_ptr<std::vector<std::shared_ptr<NormalId>>> commandNameIds;
+        //commandNameIds中每个名字对应的命令
+        std::vector<const Node::NodePerCommand *> commandNameIdCommands;
+        std::unique_ptr<NormalIdIndex> commandNameIndex;
 
     public:
 #ifndef CHELPER_NO_FILESYSTEM
@@ -59,7 +104,23 @@ namespace CHelper {
 
         void applyCommand(const rapidjson::GenericValue<rapidjson::UTF8<>> &j) const;
 
-        void afterApply();
+        void afterApply(size_t threads);
+
+        void loadIdData() const;
+
+        void loadItemIds() const;
+
+        void loadBlockIds() const;
+
+        void loadIdSets() const;
+
+        void loadJsonData() const;
+
+        void loadJsonNodes() const;
+
+        void initJsonNodes(size_t threads);
+
+        void initRepeatNodes() const;
 
     public:
 #ifndef CHELPER_NO_FILESYSTEM
@@ -70,10 +131,14 @@ namespace CHelper {
 
         static std::unique_ptr<CPack> createByBinary(std::istream &binaryReader);
 
+        static std::unique_ptr<CPack> createByBinary(const char *data, size_t size, const std::shared_ptr<const void> &owner = nullptr);
+
 #ifndef CHELPER_NO_FILESYSTEM
         void writeJsonToDirectory(const std::filesystem::path &path) const;
 #endif
 
+        void loadSections() const;
+
         [[nodiscard]] rapidjson::GenericDocument<rapidjson::UTF8<>> toJson() const;
 
 #ifndef CHELPER_NO_FILESYSTEM
@@ -87,6 +152,36 @@ namespace CHelper {
 
         [[nodiscard]] std::shared_ptr<std::vector<std::shared_ptr<NamespaceId>>>
         getNamespaceId(const std::u16string &key) const;
+
+        [[nodiscard]] std::shared_ptr<BlockIds>
+        getBlockIds() const;
+
+        [[nodiscard]] std::shared_ptr<std::vector<std::shared_ptr<ItemId>>>
+        getItemIds() const;
+
+        [[nodiscard]] const Node::NodeJsonElement *
+        getJsonNode(const std::u16string_view &id) const;
+
+        [[nodiscard]] std::pair<const RepeatData *, const Node::NodeBase *>
+        getRepeatNode(const std::u16string &key) const;
+
+        [[nodiscard]] const Node::NodePerCommand *
+        getCommand(const std::u16string_view &name) const;
+
+        [[nodiscard]] std::vector<std::shared_ptr<NormalId>>
+        searchCommandName(const std::u16string_view &str) const;
+
+        [[nodiscard]] std::shared_ptr<IdSet>
+        getNormalIdSet(const std::u16string &key) const;
+
+        [[nodiscard]] std::shared_ptr<IdSet>
+        getNamespaceIdSet(const std::u16string &key) const;
+
+        [[nodiscard]] std::shared_ptr<NormalIdIndex>
+        getNormalIdIndex(const std::u16string &key) const;
+
+        [[nodiscard]] std::shared_ptr<NamespaceIdIndex>
+        getNamespaceIdIndex(const std::u16string &key) const;
     };
 
 }// namespace CHelper
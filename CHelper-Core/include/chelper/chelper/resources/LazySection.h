@@ -0,0 +1,135 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_LAZYSECTION_H
+#define CHELPER_LAZYSECTION_H
+
+#include "pch.h"
+#include <atomic>
+#include <mutex>
+
+namespace CHelper {
+
+    /**
+     * 资源包中第一次使用时才读取和初始化的一部分内容
+     *
+     * 写入二进制资源包时在内容前面写入内容的长度。从有持有者的内存中读取时只记录内容的位置并跳过这段内容，
+     * 第一次使用时再读取；没有持有者时直接读取。
+     *
+     * 初始化时可能会通过资源包再次使用同一部分内容（例如JSON数据通过ID链接到其他JSON数据），
+     * 同一个线程再次调用load会直接返回，这时已经读取的内容和原来一次性初始化时是一样的；其他线程会等待初始化完成。
+     */
+    class LazySection {
+    private:
+        // 持有内容所在的内存，为nullptr表示没有需要延迟读取的内容
+        std::shared_ptr<const void> owner;
+        const char *data = nullptr;
+        size_t size = 0;
+        std::atomic<bool> isLoaded = false;
+        bool isLoading = false;
+        std::recursive_mutex mutex;
+
+    public:
+        LazySection() = default;
+
+        LazySection(const LazySection &) = delete;
+
+        LazySection &operator=(const LazySection &) = delete;
+
+        //是否还有没有读取的内容
+        [[nodiscard]] bool isDeferred() const;
+
+        /**
+         * 写入一段内容，内容前面是内容的长度
+         *
+         * @param write 把内容写入传入的输出流
+         */
+        template<class Function>
+        static void write(std::ostream &ostream, Function write) {
+            std::ostringstream sectionStream;
+            write(static_cast<std::ostream &>(sectionStream));
+            std::string section = std::move(sectionStream).str();
+            serialization::Codec<uint32_t>::template to_binary<true>(ostream, static_cast<uint32_t>(section.size()));
+            ostream.write(section.data(), static_cast<std::streamsize>(section.size()));
+        }
+
+        /**
+         * 读取一段内容。从有持有者的内存中读取时只记录内容的位置，否则直接读取
+         *
+         * @param read 从传入的输入流读取内容，必须正好读完这段内容
+         */
+        template<class Function>
+        void read(std::istream &istream, Function read) {
+            uint32_t sectionSize = 0;
+            serialization::Codec<uint32_t>::template from_binary<true>(istream, sectionSize);
+            if (HEDLEY_UNLIKELY(!istream)) {
+                Profile::push("fail to read section size");
+                throw std::runtime_error("fail to read section size");
+            }
+            auto *buffer = dynamic_cast<MemoryStreamBuffer *>(istream.rdbuf());
+            if (HEDLEY_LIKELY(buffer != nullptr && buffer->getOwner() != nullptr)) {
+                // 损坏或者不完整的资源包中内容的长度可能超出剩余的内容
+                if (HEDLEY_UNLIKELY(sectionSize > buffer->getRemaining())) {
+                    Profile::push("section size {} is out of range, only {} bytes remain", sectionSize, buffer->getRemaining());
+                    throw std::runtime_error("section size is out of range");
+                }
+                owner = buffer->getOwner();
+                data = buffer->getCurrent();
+                size = sectionSize;
+                istream.seekg(sectionSize, std::ios_base::cur);
+                return;
+            }
+            auto start = istream.tellg();
+            read(istream);
+            auto end = istream.tellg();
+            if (HEDLEY_UNLIKELY(!istream || (start != -1 && end != -1 && end - start != static_cast<std::streamoff>(sectionSize)))) {
+                Profile::push("section size {} does not match the content", sectionSize);
+                throw std::runtime_error("section size does not match the content");
+            }
+        }
+
+        /**
+         * 第一次调用时读取延迟读取的内容并初始化，之后的调用什么都不做，可以被多个线程同时调用
+         *
+         * @param read 从传入的输入流读取延迟读取的内容，只有还有没有读取的内容时才会调用，必须正好读完这段内容
+         * @param init 读取后的初始化，无论内容是否延迟读取都会调用一次
+         */
+        template<class Read, class Init>
+        void load(Read read, Init init) {
+            if (HEDLEY_LIKELY(isLoaded.load(std::memory_order_acquire))) {
+                return;
+            }
+            std::lock_guard<std::recursive_mutex> lock(mutex);
+            if (HEDLEY_UNLIKELY(isLoaded.load(std::memory_order_relaxed) || isLoading)) {
+                return;
+            }
+            isLoading = true;
+            try {
+                if (HEDLEY_LIKELY(data != nullptr)) {
+                    MemoryStreamBuffer buffer(data, size);
+                    std::istream istream(&buffer);
+                    read(istream);
+                    if (HEDLEY_UNLIKELY(!istream || istream.peek() != std::istream::traits_type::eof())) {
+                        Profile::push("section is not read completed");
+                        throw std::runtime_error("section is not read completed");
+                    }
+                    owner = nullptr;
+                    data = nullptr;
+                    size = 0;
+                }
+                init();
+            } catch (...) {
+                isLoading = false;
+                throw;
+            }
+            isLoading = false;
+            isLoaded.store(true, std::memory_order_release);
+        }
+    };
+
+}// namespace CHelper
+
+#endif//CHELPER_LAZYSECTION_H
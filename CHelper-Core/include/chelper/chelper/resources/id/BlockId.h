@@ -9,6 +9,7 @@
 
 #include "ItemId.h"
 #include "NamespaceId.h"
+#include <map>
 namespace CHelper {
 
     namespace PropertyType {
@@ -92,16 +93,33 @@ namespace CHelper {
                 const std::u16string &propertyName) const;
     };
 
+    /**
+     * 方块状态节点的缓存，初始化所有方块的方块状态节点时使用
+     *
+     * 属性、默认值和有效值都相同的方块状态键值对共用同一个节点，方块状态键值对都相同的方块共用同一个方块状态节点。
+     * 缓存中的节点同时持有它的子节点，最后一个持有节点的方块释放时才会释放这些节点。
+     */
+    class BlockStateNodeCache {
+    public:
+        //键为属性的介绍和由默认值、有效值组成的字符串
+        std::map<std::pair<const BlockPropertyDescription *, std::u16string>, std::shared_ptr<Node::NodeBase>> entryNodes;
+        //键为方块的所有方块状态键值对节点，没有已知的方块状态时为std::nullopt
+        std::map<std::optional<std::vector<const Node::NodeBase *>>, std::shared_ptr<Node::NodeBase>> blockStateNodes;
+    };
+
     class BlockId : public NamespaceId {
     public:
         std::optional<std::vector<Property>> properties;
 
     private:
-        std::vector<std::shared_ptr<Node::NodeBase>> nodeChildren;
+        //可能和其他方块共用，同时持有它的子节点
         std::shared_ptr<Node::NodeBase> node;
 
     public:
-        std::shared_ptr<Node::NodeBase> getNode(const BlockPropertyDescriptions &blockPropertyDescriptions);
+        //创建方块状态节点，在加载资源包时调用，之后节点不会再被修改
+        void initNode(const BlockPropertyDescriptions &blockPropertyDescriptions, BlockStateNodeCache &cache);
+
+        [[nodiscard]] const std::shared_ptr<Node::NodeBase> &getNode() const;
 
         static Node::NodeBase *getNodeAllBlockState();
     };
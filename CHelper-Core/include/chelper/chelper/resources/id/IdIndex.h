@@ -0,0 +1,94 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_IDINDEX_H
+#define CHELPER_IDINDEX_H
+
+#include "NamespaceId.h"
+#include "NormalId.h"
+#include "pch.h"
+#include <mutex>
+
+namespace CHelper {
+
+    /**
+     * 字符串搜索索引
+     *
+     * 按字符串排序的下标用于查找以某个字符串开头的字符串，时间复杂度为O(log n + k)，
+     * 字符和相邻两个字符到下标的倒排表用于查找包含某个字符串的字符串，只需要检查倒排表中最短的那一个。
+     * 查找结果都是按下标从小到大排序的，所以可以保持原来的顺序。
+     */
+    class StringIndex {
+    private:
+        //被索引的字符串，nullptr表示这个下标不参与搜索，字符串由ID列表持有
+        std::vector<const std::u16string *> strings;
+        //参与搜索的下标，按字符串排序
+        std::vector<uint32_t> sorted;
+        //单个字符到下标的倒排表
+        std::unordered_map<char16_t, std::vector<uint32_t>> unigrams;
+        //相邻两个字符到下标的倒排表
+        std::unordered_map<uint32_t, std::vector<uint32_t>> bigrams;
+
+    public:
+        explicit StringIndex(std::vector<const std::u16string *> strings);
+
+        [[nodiscard]] std::vector<uint32_t> startsWith(const std::u16string_view &prefix) const;
+
+        [[nodiscard]] std::vector<uint32_t> contains(const std::u16string_view &str) const;
+
+    private:
+        [[nodiscard]] std::vector<uint32_t> all() const;
+    };
+
+    /**
+     * NormalId列表的搜索索引，搜索结果的顺序和逐个使用KMPMatcher匹配时相同
+     *
+     * 索引在第一次搜索时才创建，避免加载资源包时为用不到的ID列表创建索引
+     */
+    class NormalIdIndex {
+    private:
+        std::shared_ptr<std::vector<std::shared_ptr<NormalId>>> contents;
+        mutable std::once_flag buildFlag;
+        mutable std::optional<StringIndex> names, descriptions;
+
+    public:
+        explicit NormalIdIndex(std::shared_ptr<std::vector<std::shared_ptr<NormalId>>> contents);
+
+        void search(const std::u16string_view &str,
+                    std::vector<uint32_t> &nameStartOf,
+                    std::vector<uint32_t> &nameContain,
+                    std::vector<uint32_t> &descriptionContain) const;
+    };
+
+    /**
+     * NamespaceId列表的搜索索引，搜索结果的顺序和逐个使用KMPMatcher匹配时相同
+     *
+     * 索引在第一次搜索时才创建，避免加载资源包时为用不到的ID列表创建索引
+     */
+    class NamespaceIdIndex {
+    private:
+        std::shared_ptr<std::vector<std::shared_ptr<NamespaceId>>> contents;
+        mutable std::once_flag buildFlag;
+        //省略了minecraft命名空间的ID，其他命名空间的ID不参与搜索
+        mutable std::optional<StringIndex> names;
+        //带有命名空间的ID
+        mutable std::optional<StringIndex> namespaceNames;
+        mutable std::optional<StringIndex> descriptions;
+
+    public:
+        explicit NamespaceIdIndex(std::shared_ptr<std::vector<std::shared_ptr<NamespaceId>>> contents);
+
+        void search(const std::u16string_view &str,
+                    std::vector<uint32_t> &nameStartOf,
+                    std::vector<uint32_t> &nameContain,
+                    std::vector<uint32_t> &namespaceStartOf,
+                    std::vector<uint32_t> &namespaceContain,
+                    std::vector<uint32_t> &descriptionContain) const;
+    };
+
+}// namespace CHelper
+
+#endif//CHELPER_IDINDEX_H
@@ -0,0 +1,48 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_IDSET_H
+#define CHELPER_IDSET_H
+
+#include "NamespaceId.h"
+#include "NormalId.h"
+#include "pch.h"
+
+namespace CHelper {
+
+    /**
+     * ID名字的哈希集合，用于O(1)判断ID是否存在
+     *
+     * 使用开放寻址法，只保存名字的哈希值，和NormalId::fastMatch一样只比较哈希值。
+     * 哈希值需要写入二进制资源包，所以不能使用平台相关的std::hash，这里使用64位FNV-1a。
+     */
+    class IdSet {
+    public:
+        //容量为2的幂，0表示空位置
+        std::vector<uint64_t> slots;
+
+        IdSet() = default;
+
+        explicit IdSet(const std::vector<std::shared_ptr<NormalId>> &contents);
+
+        //同时包含省略命名空间和带有命名空间的ID
+        explicit IdSet(const std::vector<std::shared_ptr<NamespaceId>> &contents);
+
+        [[nodiscard]] bool contains(const std::u16string_view &str) const;
+
+        static uint64_t hash(const std::u16string_view &str);
+
+    private:
+        void reserve(size_t size);
+
+        void insert(const std::u16string_view &str);
+    };
+
+}// namespace CHelper
+
+CODEC(CHelper::IdSet, slots)
+
+#endif//CHELPER_IDSET_H
@@ -0,0 +1,32 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_IDSTRINGTABLE_H
+#define CHELPER_IDSTRINGTABLE_H
+
+#include "../../util/StringPool.h"
+#include "NamespaceId.h"
+#include "NormalId.h"
+#include "pch.h"
+
+/**
+ * 在二进制资源包中保存普通ID和命名空间ID
+ *
+ * 先写入所有不同的字符串，ID中的名字、介绍和命名空间只写入字符串的编号。
+ * 很多ID的介绍和命名空间是相同的，读取时每个不同的字符串只需要解码一次。
+ */
+namespace CHelper::IdStringTable {
+
+    using NormalIds = std::unordered_map<std::u16string, std::shared_ptr<std::vector<std::shared_ptr<NormalId>>>>;
+    using NamespaceIds = std::unordered_map<std::u16string, std::shared_ptr<std::vector<std::shared_ptr<NamespaceId>>>>;
+
+    void toBinary(std::ostream &ostream, const NormalIds &normalIds, const NamespaceIds &namespaceIds);
+
+    void fromBinary(std::istream &istream, NormalIds &normalIds, NamespaceIds &namespaceIds);
+
+}// namespace CHelper::IdStringTable
+
+#endif//CHELPER_IDSTRINGTABLE_H
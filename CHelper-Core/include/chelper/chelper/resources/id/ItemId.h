@@ -9,6 +9,7 @@
 
 #include "NamespaceId.h"
 #include "pch.h"
+#include <map>
 
 namespace CHelper {
 
@@ -18,17 +19,23 @@ namespace CHelper {
 
     }// namespace Node
 
+    //物品附加值节点的缓存，键为最大附加值和附加值的介绍，这两个都相同的物品共用同一个节点
+    using ItemDataNodeCache = std::map<std::pair<std::optional<int32_t>, std::optional<std::vector<std::u16string>>>, std::shared_ptr<Node::NodeBase>>;
+
     class ItemId : public NamespaceId {
     public:
         std::optional<int32_t> max;
         std::optional<std::vector<std::u16string>> descriptions;
 
     private:
-        std::vector<std::shared_ptr<Node::NodeBase>> nodeChildren;
+        //可能和其他物品共用，同时持有它的子节点
         std::shared_ptr<Node::NodeBase> node = nullptr;
 
     public:
-        std::shared_ptr<Node::NodeBase> getNode();
+        //创建物品附加值节点，在加载资源包时调用，之后节点不会再被修改
+        void initNode(ItemDataNodeCache &cache);
+
+        [[nodiscard]] const std::shared_ptr<Node::NodeBase> &getNode() const;
     };
 
 }// namespace CHelper
@@ -29,11 +29,19 @@ namespace CHelper {
         uint32_t colorLiteral = NO_COLOR;
 
         Theme();
+
+        bool operator==(const Theme &theme) const;
+
+        bool operator!=(const Theme &theme) const;
     };
 
     class Settings {
     public:
         Theme theme;
+        //解析时是否缓存每个节点在每个位置的解析结果，可以减少重复解析，但是会占用更多内存
+        bool isEnableParseMemo = false;
+        //是否记录每种节点的解析次数、回溯的token数量和每个方法的耗时，可以通过CHelperCore::getStatistics获取
+        bool isEnableStatistics = false;
 
         Settings() = default;
     };
@@ -9,15 +9,72 @@
 
 #include <fstream>
 #include <hedley.h>
+#include <istream>
 #include <memory>
 #include <optional>
+#include <streambuf>
 #include <string>
 #include <unordered_map>
 #include <vector>
+#ifndef CHELPER_NO_FILESYSTEM
+#include <filesystem>
+#endif
 
 namespace CHelper {
 
+    /**
+     * 直接读取一段内存的streambuf，不会复制内存，内存需要在读取结束前保持有效
+     *
+     * 如果传入了内存的持有者，读取时可以保存内存的位置，之后再读取（例如延迟加载命令的节点）
+     */
+    class MemoryStreamBuffer : public std::streambuf {
+    private:
+        std::shared_ptr<const void> owner;
 
+    public:
+        MemoryStreamBuffer(const char *data, size_t size, std::shared_ptr<const void> owner = nullptr);
+
+        [[nodiscard]] const std::shared_ptr<const void> &getOwner() const;
+
+        [[nodiscard]] const char *getCurrent() const;
+
+        //还没有读取的字节数
+        [[nodiscard]] size_t getRemaining() const;
+
+    protected:
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+    };
+
+#ifndef CHELPER_NO_FILESYSTEM
+    /**
+     * 只读的内存映射文件，不支持内存映射的平台会把文件读取到内存中
+     */
+    class MappedFile {
+    private:
+        const char *data = nullptr;
+        size_t size = 0;
+#if defined(_WIN32)
+        std::vector<char> buffer;
+#else
+        void *mapped = nullptr;
+#endif
+
+    public:
+        explicit MappedFile(const std::filesystem::path &path);
+
+        MappedFile(const MappedFile &) = delete;
+
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        ~MappedFile();
+
+        [[nodiscard]] const char *getData() const;
+
+        [[nodiscard]] size_t getSize() const;
+    };
+#endif
 
 }// namespace CHelper
 
@@ -0,0 +1,66 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_LATENCYHISTOGRAM_H
+#define CHELPER_LATENCYHISTOGRAM_H
+
+#include "pch.h"
+
+namespace CHelper {
+
+    /**
+     * 耗时的百分位数，单位为纳秒
+     */
+    class LatencySnapshot {
+    public:
+        size_t count = 0;
+        uint64_t p50 = 0;
+        uint64_t p99 = 0;
+        uint64_t max = 0;
+    };
+
+    /**
+     * 记录耗时的分布，用于计算百分位数
+     *
+     * 每个2的幂次的区间被平均分为8个桶，所以得到的百分位数的相对误差不超过12.5%，
+     * 记录一次耗时只需要修改一个桶，占用的内存是固定的。
+     */
+    class LatencyHistogram {
+    public:
+        static constexpr size_t SUB_BUCKET_BITS = 3;
+        static constexpr size_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+        static constexpr size_t BUCKET_COUNT = 64 * SUB_BUCKET_COUNT;
+
+    private:
+        std::array<size_t, BUCKET_COUNT> buckets{};
+        size_t count = 0;
+        uint64_t max = 0;
+
+    public:
+        void record(uint64_t nanoseconds);
+
+        void clear();
+
+        [[nodiscard]] size_t getCount() const;
+
+        /**
+         * 获取百分位数，返回所在的桶的上界，所以不会小于真实的值
+         *
+         * @param percentile 范围为[0, 100]
+         */
+        [[nodiscard]] uint64_t getPercentile(double percentile) const;
+
+        [[nodiscard]] LatencySnapshot getSnapshot() const;
+
+        [[nodiscard]] static size_t getBucketIndex(uint64_t value);
+
+        //桶中最大的值
+        [[nodiscard]] static uint64_t getBucketUpperBound(size_t index);
+    };
+
+}// namespace CHelper
+
+#endif//CHELPER_LATENCYHISTOGRAM_H
@@ -0,0 +1,97 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_PARALLEL_H
+#define CHELPER_PARALLEL_H
+
+#include "Profile.h"
+#include <atomic>
+#include <thread>
+
+/**
+ * 简单的并行工具，用于批量检查命令和读取资源包
+ */
+namespace CHelper::Parallel {
+
+    /**
+     * @param threads 线程数量，为0时使用硬件支持的并发线程数量
+     */
+    inline size_t getThreadCount(size_t threads) {
+        if (HEDLEY_LIKELY(threads == 0)) {
+            threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+        return threads;
+    }
+
+    /**
+     * 在多个线程中对[0, size)中的每个下标调用function，调用的线程也会参与计算
+     *
+     * 每个线程从同一个计数器领取下一段下标，先完成的线程会继续领取剩下的下标，所以function需要把结果写入下标对应的位置，
+     * 这样结果的顺序和下标的顺序相同，不需要加锁，也不需要重新排序。
+     * 只需要一个线程时直接在调用的线程中按顺序执行，异常会原样抛出。无法创建更多线程时使用已经创建的线程。
+     * 有多个线程时，出现异常后其他线程会尽快停止，所有线程结束后抛出std::runtime_error，包含第一个异常的信息和出错线程的Profile栈。
+     *
+     * @param threads 线程数量，为0时使用硬件支持的并发线程数量
+     * @param chunkSize 每次领取的下标数量，太小时线程之间争抢计数器，太大时最后几个线程会空等
+     */
+    template<class Function>
+    void forEach(size_t size, size_t threads, size_t chunkSize, Function function) {
+        chunkSize = std::max<size_t>(1, chunkSize);
+        threads = std::min(getThreadCount(threads), (size + chunkSize - 1) / chunkSize);
+        if (HEDLEY_UNLIKELY(threads <= 1)) {
+            for (size_t i = 0; i < size; ++i) {
+                function(i);
+            }
+            return;
+        }
+        std::atomic<size_t> next{0};
+        std::atomic<bool> failed{false};
+        std::string failedReason;
+        auto work = [&]() {
+            // 调用的线程的栈中已经有外层的信息，出错时只需要记录这个线程新加入的信息
+            size_t stackSize = Profile::stack.size();
+            try {
+                while (HEDLEY_LIKELY(!failed.load(std::memory_order_relaxed))) {
+                    size_t start = next.fetch_add(chunkSize, std::memory_order_relaxed);
+                    if (HEDLEY_UNLIKELY(start >= size)) {
+                        break;
+                    }
+                    size_t end = std::min(start + chunkSize, size);
+                    for (size_t i = start; i < end; ++i) {
+                        function(i);
+                    }
+                }
+            } catch (const std::exception &e) {
+                if (HEDLEY_LIKELY(!failed.exchange(true))) {
+                    std::vector<std::string> stack(Profile::stack.begin() + static_cast<std::ptrdiff_t>(std::min(stackSize, Profile::stack.size())),
+                                                   Profile::stack.end());
+                    failedReason = e.what() + std::string("\nstack trace:\n") + StringUtil::join("\n", stack);
+                }
+                Profile::stack.resize(std::min(stackSize, Profile::stack.size()));
+            }
+        };
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        // 创建线程失败时（例如达到系统的线程数量限制）不再创建新的线程，剩下的下标由已经创建的线程和调用的线程完成，
+        // 这样已经创建的线程一定会在下面被join，不会在析构时调用std::terminate
+        try {
+            for (size_t i = 1; i < threads; ++i) {
+                workers.emplace_back(work);
+            }
+        } catch (const std::exception &) {
+        }
+        work();
+        for (auto &worker: workers) {
+            worker.join();
+        }
+        if (HEDLEY_UNLIKELY(failed.load())) {
+            throw std::runtime_error(failedReason);
+        }
+    }
+
+}// namespace CHelper::Parallel
+
+#endif//CHELPER_PARALLEL_H
@@ -11,10 +11,12 @@
 
 /**
  * 跟踪代码的运行，为了在遇到bug的时候方便排查错误的位置
+ *
+ * 每个线程有自己的栈，多个线程同时解析命令时不会互相影响
  */
 namespace CHelper::Profile {
 
-    extern std::vector<std::string> stack;
+    extern thread_local std::vector<std::string> stack;
 
     template<typename... T>
     void push(const std::string &fmt, T &&...args) {
@@ -33,6 +35,19 @@ namespace CHelper::Profile {
         push(fmt, args...);
     }
 
+    /**
+     * 在栈的指定位置插入信息，用于在捕获异常后补充外层的信息，这样正常运行时就不需要格式化字符串
+     */
+    template<typename... T>
+    void insert(size_t index, const std::string &fmt, T &&...args) {
+        index = std::min(index, stack.size());
+#ifdef CHelperAndroid
+        stack.insert(stack.begin() + static_cast<std::ptrdiff_t>(index), fmt::format(fmt, Logger::convertArg(args)...));
+#else
+        stack.insert(stack.begin() + static_cast<std::ptrdiff_t>(index), fmt::format(fmt, styled(Logger::convertArg(args), fg(fmt::color::medium_purple))...));
+#endif
+    }
+
     void clear();
 
     void printAndClear(const std::exception &e);
@@ -0,0 +1,44 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_STRINGPOOL_H
+#define CHELPER_STRINGPOOL_H
+
+#include "pch.h"
+#include <deque>
+#include <limits>
+
+namespace CHelper {
+
+    /**
+     * 字符串池，相同的字符串只保存一次，每个字符串有一个从0开始的编号，写入二进制资源包的字符串表时使用
+     *
+     * 字符串保存在deque中，加入新的字符串时已有的字符串的地址不会改变，所以indexes中指向这些字符串的string_view一直有效。
+     * 只在写入时使用，读取时每个ID仍然保存自己的字符串。
+     */
+    class StringPool {
+    public:
+        //表示没有字符串（std::nullopt）的编号
+        static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+    private:
+        std::deque<std::u16string> strings;
+        std::unordered_map<std::u16string_view, uint32_t> indexes;
+
+    public:
+        //加入字符串，返回它的编号，已经存在时返回之前的编号
+        uint32_t intern(const std::u16string_view &str);
+
+        uint32_t intern(const std::optional<std::u16string> &str);
+
+        [[nodiscard]] size_t size() const;
+
+        [[nodiscard]] const std::deque<std::u16string> &getStrings() const;
+    };
+
+}// namespace CHelper
+
+#endif//CHELPER_STRINGPOOL_H
@@ -0,0 +1,129 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_TRACE_H
+#define CHELPER_TRACE_H
+
+#include "SimpleLogger.h"
+
+/**
+ * 记录代码每个部分的运行时间，可以导出为Chrome的trace_event格式，使用chrome://tracing或者Perfetto查看
+ *
+ * 只有开启CHELPER_TRACE编译选项时才会编译，没有开启时所有宏都是空的，不会有任何开销。
+ * 开启后还需要调用Trace::setEnabled(true)才会开始记录，没有开始记录时只会判断一次是否开启。
+ * 每个线程把记录写入自己的环形缓冲区，缓冲区写满后会覆盖最早的记录。
+ *
+ * 和Profile不同，Trace记录的名字必须是静态字符串，参数只有在开始记录后才会格式化。
+ */
+#ifdef CHelperTrace
+
+//开始记录一段代码的运行时间，离开当前作用域时结束，每个作用域只能使用一次
+#define CHELPER_TRACE_SCOPE(name) \
+    CHelper::Trace::Scope chelperTraceScope(name)
+
+//和CHELPER_TRACE_SCOPE相同，但是会记录格式化后的参数，参数只有在开始记录后才会格式化
+#define CHELPER_TRACE_SCOPE_ARGS(name, ...) \
+    CHelper::Trace::Scope chelperTraceScope(name, [&]() { return CHelper::Trace::format(__VA_ARGS__); })
+
+//结束当前作用域正在记录的代码，开始记录下一段代码，和Profile::next类似
+#define CHELPER_TRACE_NEXT(name) \
+    chelperTraceScope.next(name)
+
+namespace CHelper::Trace {
+
+    //每个线程最多保存的记录数量
+    constexpr size_t BUFFER_CAPACITY = 1 << 16;
+
+    struct Event {
+        const char *name = nullptr;
+        std::string args;
+        //开始和结束时间，单位为纳秒
+        int64_t start = 0, end = 0;
+    };
+
+    void setEnabled(bool isEnabled);
+
+    [[nodiscard]] bool isEnabled();
+
+    //相对于程序开始运行的时间，单位为纳秒
+    [[nodiscard]] int64_t now();
+
+    void record(const char *name, std::string args, int64_t start, int64_t end);
+
+    //清空所有线程的记录
+    void clear();
+
+    /**
+     * 导出所有线程的记录
+     *
+     * @return {"traceEvents":[{"name":"...","ph":"X","ts":0,"dur":0,"pid":0,"tid":0,"args":{"detail":"..."}}]}
+     */
+    void writeChromeTrace(std::ostream &ostream);
+
+#ifndef CHELPER_NO_FILESYSTEM
+    void writeChromeTrace(const std::filesystem::path &path);
+#endif
+
+    template<typename... T>
+    std::string format(const std::string &fmt, T &&...args) {
+        return fmt::format(fmt, Logger::convertArg(args)...);
+    }
+
+    class Scope {
+    private:
+        const char *name;
+        std::string args;
+        int64_t start = 0;
+
+    public:
+        explicit Scope(const char *name)
+            : name(HEDLEY_UNLIKELY(isEnabled()) ? name : nullptr) {
+            if (HEDLEY_UNLIKELY(this->name != nullptr)) {
+                start = now();
+            }
+        }
+
+        template<class Function>
+        Scope(const char *name, Function getArgs)
+            : name(HEDLEY_UNLIKELY(isEnabled()) ? name : nullptr) {
+            if (HEDLEY_UNLIKELY(this->name != nullptr)) {
+                args = getArgs();
+                start = now();
+            }
+        }
+
+        Scope(const Scope &) = delete;
+
+        Scope &operator=(const Scope &) = delete;
+
+        ~Scope() {
+            if (HEDLEY_UNLIKELY(name != nullptr)) {
+                record(name, std::move(args), start, now());
+            }
+        }
+
+        void next(const char *nextName) {
+            if (HEDLEY_UNLIKELY(name != nullptr)) {
+                int64_t time = now();
+                record(name, std::move(args), start, time);
+                args.clear();
+                start = time;
+                name = nextName;
+            }
+        }
+    };
+
+}// namespace CHelper::Trace
+
+#else
+
+#define CHELPER_TRACE_SCOPE(name)
+#define CHELPER_TRACE_SCOPE_ARGS(name, ...)
+#define CHELPER_TRACE_NEXT(name)
+
+#endif
+
+#endif//CHELPER_TRACE_H
@@ -17,6 +17,10 @@
 #define CHelperDebug
 #endif
 
+#if _CHELPER_TRACE == true
+#define CHelperTrace
+#endif
+
 #ifdef CHelperAndroid
 #include <android/asset_manager.h>
 #include <android/asset_manager_jni.h>
@@ -65,6 +69,8 @@
 #include <chelper/util/Profile.h>
 // 简单的日志系统
 #include <chelper/util/SimpleLogger.h>
+// 记录运行时间
+#include <chelper/util/Trace.h>
 // 字符串工具类
 #include <chelper/util/StringUtil.h>
 // KMP字符串匹配算法
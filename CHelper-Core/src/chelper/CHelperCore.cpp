@@ -7,6 +7,34 @@
 
 namespace CHelper {
 
+    /**
+     * 记录一次方法调用的耗时，histogram为nullptr时不记录
+     */
+    class LatencyRecorder {
+    private:
+        LatencyHistogram *histogram;
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        explicit LatencyRecorder(LatencyHistogram *histogram)
+            : histogram(histogram) {
+            if (HEDLEY_UNLIKELY(histogram != nullptr)) {
+                start = std::chrono::steady_clock::now();
+            }
+        }
+
+        LatencyRecorder(const LatencyRecorder &) = delete;
+
+        LatencyRecorder &operator=(const LatencyRecorder &) = delete;
+
+        ~LatencyRecorder() {
+            if (HEDLEY_UNLIKELY(histogram != nullptr)) {
+                auto duration = std::chrono::steady_clock::now() - start;
+                histogram->record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+            }
+        }
+    };
+
     CHelperCore::CHelperCore(std::unique_ptr<CPack> cpack, ASTNode astNode)
         : cpack(std::move(cpack)),
           astNode(std::move(astNode)) {}
@@ -27,6 +55,12 @@ namespace CHelper {
         }
     }
 
+    CHelperCore *CHelperCore::createByBinary(const char *data, size_t size, const std::shared_ptr<const void> &owner) {
+        return create([&data, &size, &owner]() {
+            return CPack::createByBinary(data, size, owner);
+        });
+    }
+
 #ifndef CHELPER_NO_FILESYSTEM
     CHelperCore *CHelperCore::createByDirectory(const std::filesystem::path &cpackPath) {
         return create([&cpackPath]() {
@@ -49,43 +83,86 @@ namespace CHelper {
                 Profile::push("error file type -> {}", cpackPathStr);
                 throw std::runtime_error("error file type");
             }
-            // 打开文件
-            std::ifstream is(cpackPath, std::ios::binary);
-            if (HEDLEY_UNLIKELY(!is.is_open())) {
+            // 映射文件，命令的节点延迟加载，所以资源包会一直持有映射的内存
+            std::shared_ptr<MappedFile> file;
+            try {
+                file = std::make_shared<MappedFile>(cpackPath);
+            } catch (const std::runtime_error &) {
                 Profile::push("fail to read file -> {}", cpackPathStr);
-                throw std::runtime_error("fail to read file");
+                throw;
             }
             // 读取文件
-            std::unique_ptr<CPack> result = CPack::createByBinary(is);
-            // 检查文件是否读完
-            if (HEDLEY_UNLIKELY(!is.eof())) {
-                char ch;
-                is.read(&ch, 1);
-                if (HEDLEY_UNLIKELY(is.gcount() > 0)) {
-                    Profile::push("file is not read completed -> {}", cpackPathStr);
-                    throw std::runtime_error("file is not read completed");
-                }
-            }
-            // 关闭文件
-            is.close();
-            return std::move(result);
+            return CPack::createByBinary(file->getData(), file->getSize(), file);
         });
     }
 #endif
 
+    LatencyHistogram *CHelperCore::getLatencyHistogram(CoreEntryPoint::CoreEntryPoint entryPoint) const {
+        if (HEDLEY_LIKELY(!settings.isEnableStatistics)) {
+            return nullptr;
+        }
+        return &latencies[entryPoint];
+    }
+
+    const CursorIndex *CHelperCore::getCursorIndex() const {
+        if (HEDLEY_LIKELY(!isSelectionMoved)) {
+            return nullptr;
+        }
+        if (HEDLEY_UNLIKELY(cursorIndex == nullptr)) {
+            cursorIndex = std::make_unique<CursorIndex>(astNode);
+        }
+        return cursorIndex.get();
+    }
+
+    const SuggestionList *CHelperCore::getSuggestionList() {
+        if (HEDLEY_UNLIKELY(suggestionList == nullptr)) {
+            suggestionList = std::make_shared<SuggestionList>(astNode.getSuggestionList(index, getCursorIndex()));
+        }
+        return suggestionList.get();
+    }
+
     void CHelperCore::onTextChanged(const std::u16string &content, size_t index0) {
-        if (HEDLEY_LIKELY(input != content)) {
+        LatencyRecorder latencyRecorder(getLatencyHistogram(CoreEntryPoint::ON_TEXT_CHANGED));
+        bool isParsed = input != content;
+        if (HEDLEY_LIKELY(isParsed)) {
             input = content;
-            astNode = Parser::parse(input, cpack.get());
+            ParseStats *parseStats = nullptr;
+            if (HEDLEY_UNLIKELY(settings.isEnableStatistics)) {
+                lastParseStats.clear();
+                parseStats = &lastParseStats;
+            }
+            if (HEDLEY_UNLIKELY(settings.isEnableParseMemo)) {
+                ParseMemo parseMemo;
+                astNode = Parser::parse(input, cpack.get(), parseCache, &parseMemo, parseStats);
+            } else {
+                astNode = Parser::parse(input, cpack.get(), parseCache, nullptr, parseStats);
+            }
+            parseCache.attach(astNode);
             suggestions = nullptr;
+            suggestionList = nullptr;
+            cursorIndex = nullptr;
+            description = nullptr;
+            errorReasons = nullptr;
+            structure = nullptr;
+            colors = nullptr;
+            if (HEDLEY_UNLIKELY(parseStats != nullptr)) {
+                parseCount++;
+                totalParseStats += lastParseStats;
+            }
         }
         onSelectionChanged(index0);
+        if (HEDLEY_LIKELY(isParsed)) {
+            isSelectionMoved = false;
+        }
     }
 
     void CHelperCore::onSelectionChanged(size_t index0) {
         if (HEDLEY_LIKELY(index != index0)) {
             index = index0;
+            isSelectionMoved = true;
             suggestions = nullptr;
+            suggestionList = nullptr;
+            description = nullptr;
         }
     }
 
@@ -97,34 +174,85 @@ namespace CHelper {
         return &astNode;
     }
 
-    [[nodiscard]] std::u16string CHelperCore::getDescription() const {
-        return astNode.getDescription(index);
+    [[nodiscard]] const std::u16string &CHelperCore::getDescription() const {
+        LatencyRecorder latencyRecorder(getLatencyHistogram(CoreEntryPoint::GET_DESCRIPTION));
+        if (HEDLEY_LIKELY(description == nullptr)) {
+            description = std::make_shared<std::u16string>(astNode.getDescription(index, getCursorIndex()));
+        }
+        return *description;
     }
 
-    [[nodiscard]] std::vector<std::shared_ptr<ErrorReason>> CHelperCore::getErrorReasons() const {
-        return astNode.getErrorReasons();
+    [[nodiscard]] const std::vector<std::shared_ptr<ErrorReason>> &CHelperCore::getErrorReasons() const {
+        LatencyRecorder latencyRecorder(getLatencyHistogram(CoreEntryPoint::GET_ERROR_REASONS));
+        if (HEDLEY_LIKELY(errorReasons == nullptr)) {
+            errorReasons = std::make_shared<std::vector<std::shared_ptr<ErrorReason>>>(astNode.getErrorReasons());
+        }
+        return *errorReasons;
     }
 
     std::vector<Suggestion> *CHelperCore::getSuggestions() {
+        LatencyRecorder latencyRecorder(getLatencyHistogram(CoreEntryPoint::GET_SUGGESTIONS));
         if (HEDLEY_LIKELY(suggestions == nullptr)) {
-            suggestions = std::make_shared<std::vector<Suggestion>>(astNode.getSuggestions(index));
+            suggestions = std::make_shared<std::vector<Suggestion>>(getSuggestionList()->getAll());
         }
         return suggestions.get();
     }
 
-    [[nodiscard]] std::u16string CHelperCore::getStructure() const {
-        return astNode.getStructure();
+    size_t CHelperCore::getSuggestionCount() {
+        LatencyRecorder latencyRecorder(getLatencyHistogram(CoreEntryPoint::GET_SUGGESTIONS));
+        return getSuggestionList()->size();
     }
 
-    [[nodiscard]] ColoredString CHelperCore::getColors() const {
-        return astNode.getColors(settings.theme);
+    std::vector<Suggestion> CHelperCore::getSuggestions(size_t offset, size_t limit) {
+        LatencyRecorder latencyRecorder(getLatencyHistogram(CoreEntryPoint::GET_SUGGESTIONS));
+        return getSuggestionList()->get(offset, limit);
+    }
+
+    [[nodiscard]] const std::u16string &CHelperCore::getStructure() const {
+        LatencyRecorder latencyRecorder(getLatencyHistogram(CoreEntryPoint::GET_STRUCTURE));
+        if (HEDLEY_LIKELY(structure == nullptr)) {
+            structure = std::make_shared<std::u16string>(astNode.getStructure());
+        }
+        return *structure;
+    }
+
+    [[nodiscard]] const ColoredString &CHelperCore::getColors() const {
+        LatencyRecorder latencyRecorder(getLatencyHistogram(CoreEntryPoint::GET_COLORS));
+        if (HEDLEY_LIKELY(colors == nullptr || colorsTheme != settings.theme)) {
+            colors = std::make_shared<ColoredString>(astNode.getColors(settings.theme));
+            colorsTheme = settings.theme;
+        }
+        return *colors;
     }
 
     std::optional<std::pair<std::u16string, size_t>> CHelperCore::onSuggestionClick(size_t which) {
-        if (HEDLEY_UNLIKELY(suggestions == nullptr || which >= suggestions->size())) {
+        LatencyRecorder latencyRecorder(getLatencyHistogram(CoreEntryPoint::ON_SUGGESTION_CLICK));
+        if (HEDLEY_UNLIKELY(suggestionList == nullptr || which >= suggestionList->size())) {
             return std::nullopt;
         }
-        return suggestions->at(which).apply(this, astNode.tokens.toString());
+        // 应用补全提示时会修改内容，补全提示会被清空，所以要先复制一份
+        Suggestion suggestion = suggestionList->at(which);
+        return suggestion.apply(this, astNode.tokens.toString());
+    }
+
+    CoreStatistics CHelperCore::getStatistics() const {
+        CoreStatistics result;
+        result.parseCount = parseCount;
+        result.lastParse = lastParseStats;
+        result.total = totalParseStats;
+        for (size_t i = 0; i < CoreEntryPoint::COUNT; ++i) {
+            result.latencies[i] = latencies[i].getSnapshot();
+        }
+        return result;
+    }
+
+    void CHelperCore::clearStatistics() {
+        parseCount = 0;
+        lastParseStats.clear();
+        totalParseStats.clear();
+        for (auto &item: latencies) {
+            item.clear();
+        }
     }
 
     std::u16string CHelperCore::old2new(const Old2New::BlockFixData &blockFixData, const std::u16string &old) {
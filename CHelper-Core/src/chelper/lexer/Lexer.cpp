@@ -6,111 +6,153 @@
 
 namespace CHelper::Lexer {
 
-    //字符串的结束字符
-    const std::u16string endChars = u" ,@~^/$&\"'!#%+*=[{]}\\|<>`\n";
-    //可以被识别成符号的字符，这些字符不一定是字符串的结束字符
-    const std::u16string symbols = u",@~^/$&'!#%+*=[{]}\\|<>`+-=:";
+    namespace CharType {
+        enum CharType : uint8_t {
+            //字符串的结束字符
+            END = 1 << 0,
+            //可以被识别成符号的字符，这些字符不一定是字符串的结束字符
+            SYMBOL = 1 << 1,
+            //数字的组成部分
+            NUMBER = 1 << 2,
+        };
+    }// namespace CharType
+
+    static constexpr std::array<uint8_t, 128> makeCharTypes() {
+        constexpr std::u16string_view endChars = u" ,@~^/$&\"'!#%+*=[{]}\\|<>`\n";
+        constexpr std::u16string_view symbols = u",@~^/$&'!#%+*=[{]}\\|<>`+-=:";
+        std::array<uint8_t, 128> result{};
+        for (char16_t ch: endChars) {
+            result[ch] |= CharType::END;
+        }
+        for (char16_t ch: symbols) {
+            result[ch] |= CharType::SYMBOL;
+        }
+        for (char16_t ch = u'0'; ch <= u'9'; ++ch) {
+            result[ch] |= CharType::NUMBER;
+        }
+        result[u'.'] |= CharType::NUMBER;
+        return result;
+    }
+
+    /**
+     * ASCII字符的类型，其他字符都是普通的字符串字符
+     *
+     * 每个字符只需要查一次表，不需要在结束字符和符号的列表中逐个比较
+     */
+    static constexpr std::array<uint8_t, 128> charTypes = makeCharTypes();
+
+    static inline uint8_t getCharType(char16_t ch) {
+        return HEDLEY_LIKELY(ch < charTypes.size()) ? charTypes[ch] : 0;
+    }
 
     bool isNum(char16_t ch) {
-        return (ch >= '0' && ch <= '9') || ch == '.';
+        return getCharType(ch) & CharType::NUMBER;
     }
 
     bool isEndChar(char16_t ch) {
-        return std::any_of(endChars.begin(), endChars.end(), [&ch](const char16_t &endChar) {
-            return ch == endChar;
-        });
+        return getCharType(ch) & CharType::END;
     }
 
     bool isSymbol(char16_t ch) {
-        return std::any_of(symbols.begin(), symbols.end(), [&ch](const char16_t &endChar) {
-            return ch == endChar;
-        });
+        return getCharType(ch) & CharType::SYMBOL;
     }
 
-    std::optional<TokenType::TokenType> getNextTokenType(StringReader &stringReader) {
-        std::optional<char16_t> ch = stringReader.peek();
-        if (!HEDLEY_UNLIKELY(ch.has_value())) {
-            return std::nullopt;
-        } else if (HEDLEY_UNLIKELY(ch.value() == '\n')) {
-            return TokenType::LF;
-        } else if (HEDLEY_LIKELY(ch.value() == ' ')) {
-            return TokenType::WHITE_SPACE;
-        } else if (HEDLEY_UNLIKELY(isNum(ch.value()))) {
-            return TokenType::NUMBER;
-        } else if (HEDLEY_UNLIKELY(ch.value() == '+' || ch.value() == '-')) {
-            stringReader.mark();
-            ch = stringReader.next();
-            stringReader.reset();
-            if (HEDLEY_LIKELY(ch.has_value() && isNum(ch.value()))) {
-                return TokenType::NUMBER;
-            } else {
-                return TokenType::SYMBOL;
-            }
-        } else if (HEDLEY_UNLIKELY(isSymbol(ch.value()))) {
-            return TokenType::SYMBOL;
-        } else {
-            return TokenType::STRING;
-        }
+    static Token collectToken(StringReader &stringReader, TokenType::TokenType type, size_t end) {
+        stringReader.mark();
+        stringReader.index = end;
+        return {type, stringReader.indexBackup, stringReader.collect()};
     }
 
     Token nextTokenNumber(StringReader &stringReader) {
-        stringReader.mark();
-        std::optional<char16_t> ch = stringReader.peek();
-        while (ch.has_value() && (isNum(ch.value()) || ch.value() == '+' || ch.value() == '-')) {
-            ch = stringReader.next();
+        const std::u16string &content = stringReader.content;
+        size_t end = stringReader.index;
+        while (end < content.size() && (isNum(content[end]) || content[end] == u'+' || content[end] == u'-')) {
+            end++;
         }
-        return {TokenType::NUMBER, stringReader.posBackup, stringReader.collect()};
+        return collectToken(stringReader, TokenType::NUMBER, end);
     }
 
     Token nextTokenSymbol(StringReader &stringReader) {
-        stringReader.mark();
-        stringReader.skip();
-        return {TokenType::SYMBOL, stringReader.posBackup, stringReader.collect()};
+        return collectToken(stringReader, TokenType::SYMBOL, stringReader.index + 1);
     }
 
     Token nextTokenString(StringReader &stringReader) {
-        // NOTE: please ensure stringReader.peek().has_value() before call nextTokenString()
-        stringReader.mark();
-        std::optional<char16_t> ch = stringReader.peek();
-        bool isDoubleQuotation = ch.value() == '"';
-        if (HEDLEY_UNLIKELY(isDoubleQuotation)) {
-            ch = stringReader.next();
-        }
-        while (true) {
-            if (HEDLEY_UNLIKELY(!ch.has_value())) {
-                break;
-            }
-            if (HEDLEY_UNLIKELY(ch.value() == '\\')) {
-                //转义字符
-                ch = stringReader.next();
-                if (HEDLEY_UNLIKELY(!ch.has_value())) {
+        // NOTE: please ensure stringReader.ready() before call nextTokenString()
+        const std::u16string &content = stringReader.content;
+        size_t size = content.size();
+        size_t end = stringReader.index;
+        if (HEDLEY_UNLIKELY(content[end] == u'"')) {
+            //如果是双引号开头，只能使用双引号结尾
+            end++;
+            while (end < size) {
+                char16_t ch = content[end];
+                if (HEDLEY_UNLIKELY(ch == u'\\')) {
+                    //转义字符
+                    end = std::min(end + 2, size);
+                } else if (HEDLEY_UNLIKELY(ch == u'"')) {
+                    end++;
                     break;
+                } else {
+                    end++;
+                }
+            }
+        } else {
+            while (end < size) {
+                //普通字符连续出现，每个字符只需要查一次表
+                while (end < size && !(getCharType(content[end]) & CharType::END)) {
+                    end++;
                 }
-            } else if (HEDLEY_UNLIKELY(isDoubleQuotation)) {
-                //如果是双引号开头，只能使用双引号结尾
-                if (HEDLEY_UNLIKELY(ch.value() == '"')) {
-                    stringReader.skip();
+                if (HEDLEY_LIKELY(end == size || content[end] != u'\\')) {
+                    //在检测到字符串结束字符时进行结尾
                     break;
                 }
-            } else if (HEDLEY_UNLIKELY(isEndChar(ch.value()))) {
-                //在检测到字符串结束字符时进行结尾
-                break;
+                //转义字符
+                end = std::min(end + 2, size);
             }
-            ch = stringReader.next();
         }
-        return {TokenType::STRING, stringReader.posBackup, stringReader.collect()};
+        return collectToken(stringReader, TokenType::STRING, end);
     }
 
+    /**
+     * 连续的空格合并为一个token，粘贴很长的内容时不会产生大量只有一个字符的token
+     */
     Token nextTokenWhiteSpace(StringReader &stringReader) {
-        stringReader.mark();
-        stringReader.skip();
-        return {TokenType::WHITE_SPACE, stringReader.posBackup, stringReader.collect()};
+        const std::u16string &content = stringReader.content;
+        size_t end = stringReader.index + 1;
+        while (end < content.size() && content[end] == u' ') {
+            end++;
+        }
+        return collectToken(stringReader, TokenType::WHITE_SPACE, end);
     }
 
     Token nextTokenLF(StringReader &stringReader) {
-        stringReader.mark();
-        stringReader.skip();
-        return {TokenType::LF, stringReader.posBackup, stringReader.collect()};
+        return collectToken(stringReader, TokenType::LF, stringReader.index + 1);
+    }
+
+    std::optional<Token> nextToken(StringReader &stringReader) {
+        const std::u16string &content = stringReader.content;
+        size_t index = stringReader.index;
+        if (HEDLEY_UNLIKELY(index >= content.size())) {
+            return std::nullopt;
+        }
+        char16_t ch = content[index];
+        if (HEDLEY_UNLIKELY(ch == u'\n')) {
+            return nextTokenLF(stringReader);
+        } else if (HEDLEY_LIKELY(ch == u' ')) {
+            return nextTokenWhiteSpace(stringReader);
+        } else if (HEDLEY_UNLIKELY(isNum(ch))) {
+            return nextTokenNumber(stringReader);
+        } else if (HEDLEY_UNLIKELY(ch == u'+' || ch == u'-')) {
+            if (HEDLEY_LIKELY(index + 1 < content.size() && isNum(content[index + 1]))) {
+                return nextTokenNumber(stringReader);
+            } else {
+                return nextTokenSymbol(stringReader);
+            }
+        } else if (HEDLEY_UNLIKELY(isSymbol(ch))) {
+            return nextTokenSymbol(stringReader);
+        } else {
+            return nextTokenString(stringReader);
+        }
     }
 
     LexerResult lex(const std::u16string &content) {
@@ -120,27 +162,11 @@ namespace CHelper::Lexer {
 #endif
         std::vector<Token> tokenList = std::vector<Token>();
         while (true) {
-            std::optional<TokenType::TokenType> nextTokenType = getNextTokenType(stringReader);
-            if (HEDLEY_UNLIKELY(!nextTokenType.has_value())) {
+            std::optional<Token> token = nextToken(stringReader);
+            if (HEDLEY_UNLIKELY(!token.has_value())) {
                 break;
             }
-            switch (nextTokenType.value()) {
-                case TokenType::NUMBER:
-                    tokenList.push_back(nextTokenNumber(stringReader));
-                    break;
-                case TokenType::SYMBOL:
-                    tokenList.push_back(nextTokenSymbol(stringReader));
-                    break;
-                case TokenType::STRING:
-                    tokenList.push_back(nextTokenString(stringReader));
-                    break;
-                case TokenType::WHITE_SPACE:
-                    tokenList.push_back(nextTokenWhiteSpace(stringReader));
-                    break;
-                case TokenType::LF:
-                    tokenList.push_back(nextTokenLF(stringReader));
-                    break;
-            }
+            tokenList.push_back(std::move(token.value()));
         }
 #ifdef CHelperTest
         Profile::pop();
@@ -148,4 +174,85 @@ namespace CHelper::Lexer {
         return {content, std::move(tokenList)};
     }
 
+    TextEdit TextEdit::diff(const std::u16string_view &oldContent, const std::u16string_view &newContent) {
+        size_t maxLength = std::min(oldContent.size(), newContent.size());
+        size_t prefix = 0;
+        while (prefix < maxLength && oldContent[prefix] == newContent[prefix]) {
+            prefix++;
+        }
+        size_t suffix = 0;
+        while (suffix < maxLength - prefix &&
+               oldContent[oldContent.size() - 1 - suffix] == newContent[newContent.size() - 1 - suffix]) {
+            suffix++;
+        }
+        return {prefix, oldContent.size() - prefix - suffix, newContent.size() - prefix - suffix};
+    }
+
+    /**
+     * 增量词法分析，只重新扫描受到修改影响的token
+     *
+     * 每个token最多读取到下一个token的开始位置，所以从最后一个在修改位置之前开始的token开始重新扫描，
+     * 它前面的token都不会受到影响。词法分析在token的开始位置是无状态的，所以扫描到修改位置之后，
+     * 如果新的token开始位置和旧的某个token开始位置对齐，后面的token只需要平移位置。
+     *
+     * @param old 修改前的词法分析结果，只使用token的类型、位置和长度
+     * @param content 修改后的内容，新的token指向这个字符串
+     * @param edit 从修改前的内容到修改后的内容的修改
+     */
+    LexerResult relex(const LexerResult &old, const std::u16string &content, const TextEdit &edit) {
+        const std::vector<Token> &oldTokens = old.allTokens;
+        auto it = std::lower_bound(oldTokens.begin(), oldTokens.end(), edit.start,
+                                   [](const Token &token, size_t index) {
+                                       return token.index < index;
+                                   });
+        size_t first = it == oldTokens.begin() ? 0 : static_cast<size_t>(it - oldTokens.begin()) - 1;
+        std::vector<Token> tokenList;
+        tokenList.reserve(oldTokens.size() + edit.insertLength);
+        // 修改位置之前的token
+        for (size_t i = 0; i < first; ++i) {
+            const Token &token = oldTokens[i];
+            tokenList.emplace_back(token.type, token.index, std::u16string_view(content.c_str() + token.index, token.content.size()));
+        }
+        // 重新扫描受到影响的token
+        StringReader stringReader(content);
+        if (HEDLEY_LIKELY(first < oldTokens.size())) {
+            stringReader.index = oldTokens[first].index;
+        }
+        size_t editEnd = edit.start + edit.insertLength;
+        size_t oldIndex = first;
+        bool isAligned = false;
+        while (true) {
+            if (HEDLEY_LIKELY(stringReader.index >= editEnd)) {
+                size_t oldPosIndex = stringReader.index - edit.insertLength + edit.removeLength;
+                while (oldIndex < oldTokens.size() && oldTokens[oldIndex].index < oldPosIndex) {
+                    oldIndex++;
+                }
+                if (HEDLEY_LIKELY(oldIndex < oldTokens.size() && oldTokens[oldIndex].index == oldPosIndex)) {
+                    isAligned = true;
+                    break;
+                }
+            }
+            std::optional<Token> token = nextToken(stringReader);
+            if (HEDLEY_UNLIKELY(!token.has_value())) {
+                break;
+            }
+            tokenList.push_back(std::move(token.value()));
+        }
+        // 修改位置之后的token，只需要平移位置
+        if (HEDLEY_LIKELY(isAligned)) {
+            size_t oldStart = oldTokens[oldIndex].index;
+            size_t newStart = stringReader.index;
+            for (size_t i = oldIndex; i < oldTokens.size(); ++i) {
+                const Token &token = oldTokens[i];
+                size_t index = token.index - oldStart + newStart;
+                tokenList.emplace_back(token.type, index, std::u16string_view(content.c_str() + index, token.content.size()));
+            }
+        }
+        return {content, std::move(tokenList)};
+    }
+
+    LexerResult relex(const LexerResult &old, const std::u16string &content) {
+        return relex(old, content, TextEdit::diff(old.content, content));
+    }
+
 }// namespace CHelper::Lexer
\ No newline at end of file
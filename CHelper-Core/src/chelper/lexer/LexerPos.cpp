@@ -11,16 +11,6 @@ CHelper::LexerPos::LexerPos(size_t index,
       col(col),
       index(index) {}
 
-void CHelper::LexerPos::next(char16_t ch) {
-    index++;
-    if (HEDLEY_UNLIKELY(ch == '\n')) {
-        line++;
-        col = 1;
-    } else {
-        col++;
-    }
-}
-
 std::ostream &CHelper::operator<<(std::ostream &os, const CHelper::LexerPos &pos) {
     return os << '(' << pos.line << ',' << pos.col << ')';
 }
\ No newline at end of file
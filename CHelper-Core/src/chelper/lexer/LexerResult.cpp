@@ -9,6 +9,19 @@ namespace CHelper {
     LexerResult::LexerResult(std::u16string content,
                              std::vector<Token> allTokens)
         : content(std::move(content)),
-          allTokens(std::move(allTokens)) {}
+          allTokens(std::move(allTokens)) {
+        for (size_t index = this->content.find(u'\n'); index != std::u16string::npos; index = this->content.find(u'\n', index + 1)) {
+            lineStarts.push_back(index + 1);
+        }
+    }
+
+    LexerPos LexerResult::getPos(size_t index) const {
+        auto it = std::upper_bound(lineStarts.begin(), lineStarts.end(), index);
+        auto line = static_cast<size_t>(it - lineStarts.begin());
+        if (HEDLEY_LIKELY(line == 0)) {
+            return LexerPos(index, 0, index);
+        }
+        return LexerPos(index, line, index - *(it - 1) + 1);
+    }
 
 }// namespace CHelper
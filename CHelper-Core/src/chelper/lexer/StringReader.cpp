@@ -7,27 +7,24 @@
 namespace CHelper {
 
     CHelper::StringReader::StringReader(const std::u16string &content)
-        : content(content),
-          posBackup(pos) {}
+        : content(content) {}
 
     bool CHelper::StringReader::ready() const {
-        return pos.index < content.length();
+        return index < content.length();
     }
 
     std::optional<char16_t> CHelper::StringReader::read() {
         if (HEDLEY_UNLIKELY(!ready())) {
             return std::nullopt;
         }
-        char16_t ch = content[pos.index];
-        pos.next(ch);
-        return ch;
+        return content[index++];
     }
 
     bool CHelper::StringReader::skip() {
         if (HEDLEY_UNLIKELY(!ready())) {
             return false;
         }
-        pos.next(content[pos.index]);
+        index++;
         return true;
     }
 
@@ -40,23 +37,19 @@ namespace CHelper {
         if (HEDLEY_UNLIKELY(!ready())) {
             return std::nullopt;
         }
-        return content[pos.index];
+        return content[index];
     }
 
     void CHelper::StringReader::mark() {
-        posBackup.line = pos.line;
-        posBackup.col = pos.col;
-        posBackup.index = pos.index;
+        indexBackup = index;
     }
 
     void CHelper::StringReader::reset() {
-        pos.line = posBackup.line;
-        pos.col = posBackup.col;
-        pos.index = posBackup.index;
+        index = indexBackup;
     }
 
     std::u16string_view CHelper::StringReader::collect() const {
-        return {content.c_str() + posBackup.index, pos.index - posBackup.index};
+        return {content.c_str() + indexBackup, index - indexBackup};
     }
 
 }// namespace CHelper
\ No newline at end of file
@@ -28,18 +28,18 @@ namespace CHelper {
     }// namespace TokenType
 
     Token::Token(TokenType::TokenType type,
-                 CHelper::LexerPos pos,
+                 size_t index,
                  const std::u16string_view &content)
         : type(type),
-          pos(pos),
+          index(index),
           content(content) {}
 
     size_t Token::getStartIndex() const {
-        return pos.index;
+        return index;
     }
 
     size_t Token::getEndIndex() const {
-        return pos.index + content.size();
+        return index + content.size();
     }
 
 }// namespace CHelper
@@ -70,7 +70,7 @@ std::ostream &operator<<(std::ostream &os, const CHelper::Token &token) {
     return os << '['
               << token.type
               << "] "
-              << token.pos
+              << token.index
               << ' '
               << token.content;
 }
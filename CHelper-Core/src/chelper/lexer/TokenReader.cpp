@@ -4,6 +4,7 @@
 
 #include <chelper/lexer/TokenReader.h>
 #include <chelper/node/NodeBase.h>
+#include <chelper/parser/ParseStats.h>
 
 namespace CHelper {
 
@@ -39,15 +40,19 @@ namespace CHelper {
             return false;
         }
         index++;
+        if (HEDLEY_UNLIKELY(index > maxIndex)) {
+            maxIndex = index;
+        }
         return true;
     }
 
     size_t TokenReader::skipWhitespace() {
-        size_t start = index;
+        size_t count = 0;
         while (ready() && peek()->type == TokenType::WHITE_SPACE) {
+            count += peek()->content.size();
             skip();
         }
-        return index - start;
+        return count;
     }
 
     void TokenReader::skipToLF() {
@@ -94,14 +99,18 @@ namespace CHelper {
      * 从栈中移除指针，恢复指针
      */
     void TokenReader::restore() {
-        index = getAndPopLastIndex();
+        size_t lastIndex = getAndPopLastIndex();
+        if (HEDLEY_UNLIKELY(parseStats != nullptr && index > lastIndex)) {
+            parseStats->backtrackTokens += index - lastIndex;
+        }
+        index = lastIndex;
     }
 
     /**
      * 收集栈中最后一个指针位置到当前指针的token，从栈中移除指针，不恢复指针
      */
     TokensView CHelper::TokenReader::collect() {
-        return {lexerResult, getAndPopLastIndex(), index};
+        return {lexerResult.get(), getAndPopLastIndex(), index};
     }
 
     ASTNode TokenReader::readSimpleASTNode(const Node::NodeBase *node,
@@ -5,9 +5,26 @@
 #include <chelper/node/NodeBase.h>
 #include <chelper/node/NodeType.h>
 #include <chelper/node/param/NodeLF.h>
+#include <chelper/parser/ParseCache.h>
+#include <chelper/parser/ParseMemo.h>
+#include <chelper/parser/ParseStats.h>
 
 namespace CHelper::Node {
 
+#ifdef CHelperTrace
+    const char *getTraceName(NodeTypeId::NodeTypeId id) {
+        static const std::vector<std::string> names = []() {
+            std::vector<std::string> result;
+            result.reserve(MAX_TYPE_ID + 1);
+            for (size_t i = 0; i <= MAX_TYPE_ID; ++i) {
+                result.push_back("getASTNode(" + utf8::utf16to8(NodeTypeHelper::getName(static_cast<NodeTypeId::NodeTypeId>(i))) + ")");
+            }
+            return result;
+        }();
+        return names[id].c_str();
+    }
+#endif
+
     NodeBase::NodeBase(const std::optional<std::u16string> &id,
                        const std::optional<std::u16string> &description,
                        bool isMustAfterWhiteSpace)
@@ -23,6 +40,27 @@ namespace CHelper::Node {
     }
 
     ASTNode NodeBase::getASTNodeWithNextNode(TokenReader &tokenReader, const CPack *cpack, bool isRequireWhitespace) const {
+        ParseMemo *parseMemo = tokenReader.parseMemo;
+        if (HEDLEY_LIKELY(parseMemo == nullptr)) {
+            return getASTNodeWithNextNodeWithoutMemo(tokenReader, cpack, isRequireWhitespace);
+        }
+        size_t start = tokenReader.index;
+        const ParseMemo::Item *item = parseMemo->find(this, start, isRequireWhitespace);
+        if (HEDLEY_UNLIKELY(item != nullptr)) {
+            tokenReader.index = item->end;
+            tokenReader.maxIndex = std::max(tokenReader.maxIndex, item->maxIndex);
+            return item->astNode;
+        }
+        size_t parentMaxIndex = tokenReader.maxIndex;
+        tokenReader.maxIndex = start;
+        ASTNode result = getASTNodeWithNextNodeWithoutMemo(tokenReader, cpack, isRequireWhitespace);
+        size_t maxIndex = std::max(tokenReader.maxIndex, tokenReader.index);
+        parseMemo->save(this, start, isRequireWhitespace, tokenReader.index, maxIndex, result);
+        tokenReader.maxIndex = std::max(parentMaxIndex, maxIndex);
+        return result;
+    }
+
+    ASTNode NodeBase::getASTNodeWithNextNodeWithoutMemo(TokenReader &tokenReader, const CPack *cpack, bool isRequireWhitespace) const {
         //空格检测
         tokenReader.push();
         if (HEDLEY_UNLIKELY(isRequireWhitespace && getNodeType() != NodeTypeId::LF && tokenReader.skipWhitespace() == 0)) {
@@ -33,10 +71,14 @@ namespace CHelper::Node {
         tokenReader.push();
         //当前节点
         DEBUG_GET_NODE_BEGIN(this)
-        ASTNode currentASTNode = getASTNode(tokenReader, cpack);
+        ASTNode currentASTNode = getASTNodeWithCache(tokenReader, cpack);
         DEBUG_GET_NODE_END(this)
+        // 节点自己的getASTNode可能会读取OR类型子节点的每个分支，所以只能在这里丢弃失败的分支
+        if (HEDLEY_UNLIKELY(tokenReader.isOnlyErrorReasons)) {
+            currentASTNode.dropLosingChildNodes();
+        }
         if (HEDLEY_UNLIKELY(currentASTNode.isError() || nextNodes.empty())) {
-            return ASTNode::andNode(this, {std::move(currentASTNode)}, tokenReader.collect(), nullptr, ASTNodeId::COMPOUND);
+            return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(currentASTNode)), tokenReader.collect(), nullptr, ASTNodeId::COMPOUND);
         }
         //子节点
         std::vector<ASTNode> childASTNodes;
@@ -49,16 +91,51 @@ namespace CHelper::Node {
         tokenReader.push();
         tokenReader.skipToLF();
         ASTNode nextASTNode = ASTNode::orNode(this, std::move(childASTNodes), tokenReader.collect(), nullptr, ASTNodeId::NEXT_NODE);
-        return ASTNode::andNode(this, {std::move(currentASTNode), std::move(nextASTNode)}, tokenReader.collect(), nullptr, ASTNodeId::COMPOUND);
+        if (HEDLEY_UNLIKELY(tokenReader.isOnlyErrorReasons)) {
+            nextASTNode.dropLosingChildNodes();
+        }
+        return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(currentASTNode), std::move(nextASTNode)), tokenReader.collect(), nullptr, ASTNodeId::COMPOUND);
+    }
+
+    /**
+     * 增量解析时，如果上一次解析中这个节点在相同位置的结果没有受到修改的影响，直接复用上一次的结果
+     */
+    ASTNode NodeBase::getASTNodeWithCache(TokenReader &tokenReader, const CPack *cpack) const {
+        CHELPER_TRACE_GET_AST_NODE(this);
+        ParseCache *parseCache = tokenReader.parseCache;
+        if (HEDLEY_LIKELY(parseCache == nullptr)) {
+            return dispatchASTNode(this, tokenReader, cpack);
+        }
+        size_t start = tokenReader.index;
+        const ParseCache::Item *item = parseCache->find(this, start);
+        if (HEDLEY_UNLIKELY(item != nullptr)) {
+            tokenReader.index = item->end;
+            tokenReader.maxIndex = std::max(tokenReader.maxIndex, item->maxIndex);
+            parseCache->record(this, start, item->end, item->maxIndex);
+            return parseCache->copy(*item);
+        }
+        size_t parentMaxIndex = tokenReader.maxIndex;
+        tokenReader.maxIndex = start;
+        ASTNode result = dispatchASTNode(this, tokenReader, cpack);
+        size_t maxIndex = std::max(tokenReader.maxIndex, tokenReader.index);
+        parseCache->record(this, start, tokenReader.index, maxIndex);
+        tokenReader.maxIndex = std::max(parentMaxIndex, maxIndex);
+        return result;
+    }
+
+    ASTNode NodeBase::dispatchASTNode(const NodeBase *node, TokenReader &tokenReader, const CPack *cpack) {
+        CHELPER_TRACE_GET_AST_NODE(node);
+        ParseStats::onGetASTNode(tokenReader, node);
+        return node->getASTNode(tokenReader, cpack);
     }
 
     ASTNode NodeBase::getByChildNode(TokenReader &tokenReader,
                                      const CPack *cpack,
                                      const NodeBase *childNode,
                                      const ASTNodeId::ASTNodeId &astNodeId) const {
-        ASTNode node = childNode->getASTNode(tokenReader, cpack);
+        ASTNode node = dispatchASTNode(childNode, tokenReader, cpack);
         TokensView tokens = node.tokens;
-        return ASTNode::andNode(this, {std::move(node)}, tokens, nullptr, astNodeId);
+        return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(node)), tokens, nullptr, astNodeId);
     }
 
     /**
@@ -153,6 +230,29 @@ namespace CHelper::Node {
         nextNodes[0]->collectStructureWithNextNodes(structure, isMustHave);
     }
 
+    void NodeBase::generate(CommandGenerator &generator) const {
+    }
+
+    void NodeBase::generateWithNextNodes(CommandGenerator &generator) const {
+        generateWithNextNodes(generator, isAfterWhitespace());
+    }
+
+    //和getASTNodeWithNextNode的空格检测相同
+    void NodeBase::generateWithNextNodes(CommandGenerator &generator, bool isRequireWhitespace) const {
+        if (HEDLEY_UNLIKELY(!generator.push())) {
+            return;
+        }
+        if (HEDLEY_UNLIKELY(isRequireWhitespace && getNodeType() != NodeTypeId::LF)) {
+            generator.append(u' ');
+        }
+        generate(generator);
+        if (HEDLEY_LIKELY(!nextNodes.empty())) {
+            const NodeBase *nextNode = generator.nextNode(nextNodes);
+            nextNode->generateWithNextNodes(generator, isAfterWhitespace() || nextNode->isAfterWhitespace());
+        }
+        generator.pop();
+    }
+
     bool NodeBase::isAfterWhitespace() const {
         return isMustAfterWhiteSpace.value_or(false);
     }
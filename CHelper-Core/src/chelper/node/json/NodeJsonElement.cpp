@@ -76,4 +76,12 @@ namespace CHelper::Node {
         return jsonElement.get();
     }
 
+    void NodeJsonElement::generate(CommandGenerator &generator) const {
+        if (HEDLEY_UNLIKELY(start == nullptr)) {
+            generator.fail();
+            return;
+        }
+        start->generate(generator);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
@@ -71,4 +71,8 @@ namespace CHelper::Node {
         return &nodeJsonAllEntry;
     }
 
+    void NodeJsonEntry::generate(CommandGenerator &generator) const {
+        (HEDLEY_UNLIKELY(nodeEntry == nullptr) ? nodeAllEntry.get() : nodeEntry.get())->generate(generator);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
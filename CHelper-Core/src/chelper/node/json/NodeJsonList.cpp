@@ -50,9 +50,9 @@ namespace CHelper::Node {
             return getByChildNode(tokenReader, cpack, nodeAllList.get(), ASTNodeId::NODE_JSON_ALL_LIST);
         }
         tokenReader.push();
-        ASTNode result1 = nodeList->getASTNode(tokenReader, cpack);
+        ASTNode result1 = dispatchASTNode(nodeList.get(), tokenReader, cpack);
         if (HEDLEY_LIKELY(!result1.isError())) {
-            return ASTNode::andNode(this, {std::move(result1)}, tokenReader.collect());
+            return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(result1)), tokenReader.collect());
         }
         size_t index1 = tokenReader.index;
         tokenReader.restore();
@@ -62,7 +62,7 @@ namespace CHelper::Node {
         tokenReader.restore();
         tokenReader.push();
         tokenReader.index = result1.isError() ? index2 : index1;
-        return ASTNode::orNode(this, {std::move(result1), std::move(result2)}, tokenReader.collect());
+        return ASTNode::orNode(this, ASTNode::makeChildNodes(std::move(result1), std::move(result2)), tokenReader.collect());
     }
 
     bool NodeJsonList::collectSuggestions(const ASTNode *astNode,
@@ -71,4 +71,8 @@ namespace CHelper::Node {
         return astNode->id == ASTNodeId::NODE_JSON_ALL_LIST;
     }
 
+    void NodeJsonList::generate(CommandGenerator &generator) const {
+        (HEDLEY_UNLIKELY(nodeList == nullptr) ? nodeAllList.get() : nodeList.get())->generate(generator);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
@@ -21,10 +21,10 @@ namespace CHelper::Node {
         std::u16string_view str = result.tokens.toString();
         if (HEDLEY_LIKELY(str.empty())) {
             TokensView tokens = result.tokens;
-            return ASTNode::andNode(this, {std::move(result)}, tokens, ErrorReason::contentError(tokens, u"null参数为空"));
+            return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(result)), tokens, ErrorReason::contentError(tokens, u"null参数为空"));
         } else if (HEDLEY_LIKELY(str != u"null")) {
             TokensView tokens = result.tokens;
-            return ASTNode::andNode(this, {std::move(result)}, tokens, ErrorReason::contentError(tokens, u"内容不是null -> " + std::u16string(str)));
+            return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(result)), tokens, ErrorReason::contentError(tokens, u"内容不是null -> " + std::u16string(str)));
         }
         return result;
     }
@@ -49,4 +49,8 @@ namespace CHelper::Node {
         return true;
     }
 
+    void NodeJsonNull::generate(CommandGenerator &generator) const {
+        generator.append(u"null");
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
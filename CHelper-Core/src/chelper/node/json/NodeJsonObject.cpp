@@ -64,4 +64,8 @@ namespace CHelper::Node {
         return getByChildNode(tokenReader, cpack, nodeList.get());
     }
 
+    void NodeJsonObject::generate(CommandGenerator &generator) const {
+        nodeList->generate(generator);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
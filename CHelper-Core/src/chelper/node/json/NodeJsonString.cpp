@@ -54,7 +54,6 @@ namespace CHelper::Node {
             convertResult.errorReason->end--;
             return {ASTNode::simpleNode(node, tokens, convertResult.errorReason), std::move(convertResult)};
         }
-        auto tokenReader = TokenReader(std::make_shared<LexerResult>(Lexer::lex(convertResult.result)));
 #ifdef CHelperTest
         Profile::push("start parsing: {}", content);
 #endif
@@ -87,7 +86,7 @@ namespace CHelper::Node {
         }
         size_t offset = tokens.getStartIndex() + 1;
         auto innerNode = getInnerASTNode(this, tokens, std::u16string(str), cpack, nodeData.get());
-        ASTNode newResult = ASTNode::andNode(this, {std::move(innerNode.first)}, tokens, errorReason, ASTNodeId::NODE_STRING_INNER);
+        ASTNode newResult = ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(innerNode.first)), tokens, errorReason, ASTNodeId::NODE_STRING_INNER);
         if (HEDLEY_UNLIKELY(errorReason == nullptr)) {
             for (auto &item: newResult.errorReasons) {
                 item = std::make_shared<ErrorReason>(
@@ -173,4 +172,22 @@ namespace CHelper::Node {
         return true;
     }
 
+    void NodeJsonString::generate(CommandGenerator &generator) const {
+        if (HEDLEY_LIKELY(!data.has_value() || data->empty())) {
+            generator.append(u'"');
+            generator.appendWord();
+            generator.append(u'"');
+            return;
+        }
+        // 字符串的内容单独生成，转义后放在双引号内
+        std::u16string outer = std::move(generator.result);
+        generator.result.clear();
+        nodeData->generate(generator);
+        std::u16string inner = JsonUtil::string2jsonString(generator.result);
+        generator.result = std::move(outer);
+        generator.append(u'"');
+        generator.append(inner);
+        generator.append(u'"');
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
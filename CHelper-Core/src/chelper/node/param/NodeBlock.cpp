@@ -11,7 +11,7 @@ namespace CHelper::Node {
             u"BLOCK_STATE_LEFT_BRACKET", u"方块状态左括号", u'[');
 
     void NodeBlock::init(const CPack &cpack) {
-        blockIds = cpack.blockIds;
+        blockIds = cpack.getBlockIds();
         nodeBlockId = std::make_shared<NodeNamespaceId>(u"BLOCK_ID", u"方块ID", u"blocks", true);
         nodeBlockId->init(cpack);
     }
@@ -28,10 +28,10 @@ namespace CHelper::Node {
             return blockId;
         }
         tokenReader.push();
-        ASTNode blockStateLeftBracket = nodeBlockStateLeftBracket->getASTNode(tokenReader, cpack);
+        ASTNode blockStateLeftBracket = dispatchASTNode(nodeBlockStateLeftBracket.get(), tokenReader, cpack);
         tokenReader.restore();
         if (HEDLEY_LIKELY(blockStateLeftBracket.isError())) {
-            return ASTNode::andNode(this, {blockId}, tokenReader.collect(),
+            return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(blockId)), tokenReader.collect(),
                                     nullptr, ASTNodeId::NODE_BLOCK_BLOCK_AND_BLOCK_STATE);
         }
         size_t strHash = std::hash<std::u16string_view>{}(blockId.tokens.toString());
@@ -44,9 +44,9 @@ namespace CHelper::Node {
         }
         auto nodeBlockState = currentBlock == nullptr
                                       ? BlockId::getNodeAllBlockState()
-                                      : std::static_pointer_cast<BlockId>(currentBlock)->getNode(blockIds->blockPropertyDescriptions).get();
+                                      : std::static_pointer_cast<BlockId>(currentBlock)->getNode().get();
         auto astNodeBlockState = getByChildNode(tokenReader, cpack, nodeBlockState, ASTNodeId::NODE_BLOCK_BLOCK_STATE);
-        return ASTNode::andNode(this, {blockId, astNodeBlockState}, tokenReader.collect(),
+        return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(blockId), std::move(astNodeBlockState)), tokenReader.collect(),
                                 nullptr, ASTNodeId::NODE_BLOCK_BLOCK_AND_BLOCK_STATE);
     }
 
@@ -77,4 +77,11 @@ namespace CHelper::Node {
         }
     }
 
+    void NodeBlock::generate(CommandGenerator &generator) const {
+        nodeBlockId->generate(generator);
+        if (HEDLEY_UNLIKELY(nodeBlockType == NodeBlockType::BLOCK_WITH_BLOCK_STATE && generator.nextBoolean(20))) {
+            generator.append(u"[]");
+        }
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
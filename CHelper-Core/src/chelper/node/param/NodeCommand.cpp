@@ -13,12 +13,12 @@ namespace CHelper::Node {
 
     NodeCommand::NodeCommand(const std::optional<std::u16string> &id,
                              const std::optional<std::u16string> &description,
-                             std::vector<std::unique_ptr<Node::NodePerCommand>> *commands)
+                             const CPack *cpack)
         : NodeBase(id, description, false),
-          commands(commands) {}
+          cpack(cpack) {}
 
-    void NodeCommand::init(const CPack &cpack) {
-        commands = cpack.commands.get();
+    void NodeCommand::init(const CPack &cpack0) {
+        cpack = &cpack0;
     }
 
     NodeTypeId::NodeTypeId NodeCommand::getNodeType() const {
@@ -27,7 +27,7 @@ namespace CHelper::Node {
 
     ASTNode NodeCommand::getASTNode(TokenReader &tokenReader, const CPack *cpack) const {
         tokenReader.push();
-        ASTNode commandStart = nodeCommandStart->getASTNode(tokenReader, cpack);
+        ASTNode commandStart = dispatchASTNode(nodeCommandStart.get(), tokenReader, cpack);
         if (HEDLEY_UNLIKELY(commandStart.isError())) {
             tokenReader.restore();
             tokenReader.push();
@@ -35,32 +35,19 @@ namespace CHelper::Node {
         ASTNode commandName = tokenReader.readStringASTNode(this, ASTNodeId::NODE_COMMAND_COMMAND_NAME);
         if (HEDLEY_UNLIKELY(commandName.tokens.size() == 0)) {
             TokensView tokens = tokenReader.collect();
-            return ASTNode::andNode(this, {std::move(commandName)}, tokens, ErrorReason::contentError(tokens, u"命令名字为空"), ASTNodeId::NODE_COMMAND_COMMAND);
+            return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(commandName)), tokens, ErrorReason::contentError(tokens, u"命令名字为空"), ASTNodeId::NODE_COMMAND_COMMAND);
         }
         std::u16string_view str = commandName.tokens.toString();
         const NodePerCommand *currentCommand = nullptr;
         if (HEDLEY_LIKELY(!commandName.isError())) {
-            bool isBreak = false;
-            for (const auto &item: *commands) {
-                currentCommand = (NodePerCommand *) item.get();
-                for (const auto &item2: currentCommand->name) {
-                    if (HEDLEY_UNLIKELY(str == item2)) {
-                        isBreak = true;
-                        break;
-                    }
-                }
-                if (HEDLEY_UNLIKELY(isBreak)) {
-                    break;
-                }
-                currentCommand = nullptr;
-            }
+            currentCommand = cpack->getCommand(str);
         }
         if (HEDLEY_UNLIKELY(currentCommand == nullptr)) {
             TokensView tokens = tokenReader.collect();
-            return ASTNode::andNode(this, {std::move(commandName)}, tokens, ErrorReason::contentError(tokens, fmt::format(u"命令名字不匹配，找不到名为{}的命令", str)), ASTNodeId::NODE_COMMAND_COMMAND);
+            return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(commandName)), tokens, ErrorReason::contentError(tokens, fmt::format(u"命令名字不匹配，找不到名为{}的命令", str)), ASTNodeId::NODE_COMMAND_COMMAND);
         }
-        ASTNode usage = currentCommand->getASTNode(tokenReader, cpack);
-        return ASTNode::andNode(this, {std::move(commandName), std::move(usage)},
+        ASTNode usage = dispatchASTNode(currentCommand, tokenReader, cpack);
+        return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(commandName), std::move(usage)),
                                 tokenReader.collect(), nullptr, ASTNodeId::NODE_COMMAND_COMMAND);
     }
 
@@ -83,43 +70,7 @@ namespace CHelper::Node {
         }
         std::u16string_view str = astNode->tokens.toString()
                                        .substr(0, index - astNode->tokens.getStartIndex());
-        std::vector<std::shared_ptr<NormalId>> nameStartOf, nameContain, descriptionContain;
-        for (const auto &item: *commands) {
-            //通过名字进行搜索
-            bool flag = false;
-            for (const auto &item2: ((NodePerCommand *) item.get())->name) {
-                size_t index1 = item2.find(str);
-                if (HEDLEY_UNLIKELY(index1 != std::u16string::npos)) {
-                    if (HEDLEY_UNLIKELY(index1 == 0)) {
-                        nameStartOf.push_back(NormalId::make(item2, item->description));
-                    } else {
-                        nameContain.push_back(NormalId::make(item2, item->description));
-                    }
-                    flag = true;
-                }
-            }
-            if (HEDLEY_UNLIKELY(flag)) {
-                continue;
-            }
-            //通过介绍进行搜索
-            if (HEDLEY_UNLIKELY(item->description.has_value() &&
-                                item->description.value().find(str) != std::u16string::npos)) {
-                for (const auto &item2: ((NodePerCommand *) item.get())->name) {
-                    descriptionContain.push_back(NormalId::make(item2, item->description));
-                }
-            }
-        }
-        auto compare = [](const auto &item1, const auto &item2) {
-            return item1->name < item2->name;
-        };
-        std::sort(nameStartOf.begin(), nameStartOf.end(), compare);
-        std::sort(nameContain.begin(), nameContain.end(), compare);
-        std::sort(descriptionContain.begin(), descriptionContain.end(), compare);
-        std::vector<std::shared_ptr<NormalId>> suggestions1;
-        suggestions1.reserve(nameStartOf.size() + nameContain.size() + descriptionContain.size());
-        suggestions1.insert(suggestions1.end(), nameStartOf.begin(), nameStartOf.end());
-        suggestions1.insert(suggestions1.end(), nameContain.begin(), nameContain.end());
-        suggestions1.insert(suggestions1.end(), descriptionContain.begin(), descriptionContain.end());
+        std::vector<std::shared_ptr<NormalId>> suggestions1 = cpack->searchCommandName(str);
         Suggestions suggestions2(SuggestionsType::ID);
         size_t start = astNode->tokens.getStartIndex();
         size_t end = astNode->tokens.getEndIndex();
@@ -154,4 +105,17 @@ namespace CHelper::Node {
         return false;
     }
 
+    void NodeCommand::generate(CommandGenerator &generator) const {
+        if (HEDLEY_UNLIKELY(cpack->commands->empty())) {
+            generator.fail();
+            return;
+        }
+        const auto &command = generator.nextElement(*cpack->commands);
+        if (HEDLEY_UNLIKELY(generator.nextBoolean(10))) {
+            generator.append(u'/');
+        }
+        generator.append(generator.nextElement(command->name));
+        command->generate(generator);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
@@ -7,8 +7,8 @@
 
 namespace CHelper::Node {
 
-    void NodeCommandName::init(const CPack &cpack) {
-        commands = cpack.commands.get();
+    void NodeCommandName::init(const CPack &cpack0) {
+        cpack = &cpack0;
     }
 
     NodeTypeId::NodeTypeId NodeCommandName::getNodeType() const {
@@ -25,12 +25,8 @@ namespace CHelper::Node {
             return true;
         }
         std::u16string_view str = astNode->tokens.toString();
-        for (const auto &command: *commands) {
-            for (const auto &name: ((NodePerCommand *) command.get())->name) {
-                if (HEDLEY_UNLIKELY(str == name)) {
-                    return true;
-                }
-            }
+        if (HEDLEY_LIKELY(cpack->getCommand(str) != nullptr)) {
+            return true;
         }
         idErrorReasons.push_back(ErrorReason::idError(astNode->tokens, std::u16string(u"找不到命令名 -> ").append(str)));
         return true;
@@ -41,43 +37,7 @@ namespace CHelper::Node {
                                              std::vector<Suggestions> &suggestions) const {
         std::u16string_view str = astNode->tokens.toString()
                                        .substr(0, index - astNode->tokens.getStartIndex());
-        std::vector<std::shared_ptr<NormalId>> nameStartOf, nameContain, descriptionContain;
-        for (const auto &item: *commands) {
-            bool flag = false;
-            for (const auto &item2: ((NodePerCommand *) item.get())->name) {
-                //通过名字进行搜索
-                size_t index1 = item2.find(str);
-                if (HEDLEY_UNLIKELY(index1 != std::u16string::npos)) {
-                    if (HEDLEY_UNLIKELY(index1 == 0)) {
-                        nameStartOf.push_back(NormalId::make(item2, item->description));
-                    } else {
-                        nameContain.push_back(NormalId::make(item2, item->description));
-                    }
-                    flag = true;
-                }
-            }
-            if (HEDLEY_UNLIKELY(flag)) {
-                continue;
-            }
-            //通过介绍进行搜索
-            if (HEDLEY_UNLIKELY(item->description.has_value() &&
-                                item->description.value().find(str) != std::u16string::npos)) {
-                for (const auto &item2: ((NodePerCommand *) item.get())->name) {
-                    descriptionContain.push_back(NormalId::make(item2, item->description));
-                }
-            }
-        }
-        auto compare = [](const auto &item1, const auto &item2) {
-            return item1->name < item2->name;
-        };
-        std::sort(nameStartOf.begin(), nameStartOf.end(), compare);
-        std::sort(nameContain.begin(), nameContain.end(), compare);
-        std::sort(descriptionContain.begin(), descriptionContain.end(), compare);
-        std::vector<std::shared_ptr<NormalId>> suggestions1;
-        suggestions1.reserve(nameStartOf.size() + nameContain.size() + descriptionContain.size());
-        suggestions1.insert(suggestions1.end(), nameStartOf.begin(), nameStartOf.end());
-        suggestions1.insert(suggestions1.end(), nameContain.begin(), nameContain.end());
-        suggestions1.insert(suggestions1.end(), descriptionContain.begin(), descriptionContain.end());
+        std::vector<std::shared_ptr<NormalId>> suggestions1 = cpack->searchCommandName(str);
         Suggestions suggestions2(SuggestionsType::ID);
         size_t start = astNode->tokens.getStartIndex();
         size_t end = astNode->tokens.getEndIndex();
@@ -104,4 +64,12 @@ namespace CHelper::Node {
         return true;
     }
 
+    void NodeCommandName::generate(CommandGenerator &generator) const {
+        if (HEDLEY_UNLIKELY(cpack->commands->empty())) {
+            generator.fail();
+            return;
+        }
+        generator.append(generator.nextElement(generator.nextElement(*cpack->commands)->name));
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
@@ -44,4 +44,11 @@ namespace CHelper::Node {
         return true;
     }
 
+    void NodeIntegerWithUnit::generate(CommandGenerator &generator) const {
+        generator.appendInteger(0, 100);
+        if (HEDLEY_LIKELY(!units->empty() && generator.nextBoolean())) {
+            generator.append(generator.nextElement(*units)->name);
+        }
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
@@ -13,7 +13,7 @@ namespace CHelper::Node {
     static std::shared_ptr<NodeBase> nodeAllData = NodeInteger::make(u"ITEM_DATA", u"物品附加值", -1, std::nullopt);
 
     void NodeItem::init(const CPack &cpack) {
-        itemIds = cpack.itemIds;
+        itemIds = cpack.getItemIds();
         nodeItemId = std::make_unique<NodeNamespaceId>(u"ITEM_ID", u"物品ID", u"items", true);
         nodeComponent = std::make_unique<NodeJson>(u"ITEM_COMPONENT", u"物品组件", u"components");
         nodeItemId->init(cpack);
@@ -26,7 +26,7 @@ namespace CHelper::Node {
 
     ASTNode NodeItem::getASTNode(TokenReader &tokenReader, const CPack *cpack) const {
         tokenReader.push();
-        ASTNode itemId = nodeItemId->getASTNode(tokenReader, cpack);
+        ASTNode itemId = dispatchASTNode(nodeItemId.get(), tokenReader, cpack);
         size_t strHash = std::hash<std::u16string_view>{}(itemId.tokens.toString());
         std::shared_ptr<NamespaceId> currentItem = nullptr;
         for (const auto &item: *itemIds) {
@@ -80,4 +80,12 @@ namespace CHelper::Node {
         }
     }
 
+    void NodeItem::generate(CommandGenerator &generator) const {
+        nodeItemId->generate(generator);
+        if (HEDLEY_LIKELY(nodeItemType != NodeItemType::ITEM_CLEAR && generator.nextBoolean(30))) {
+            generator.append(u' ');
+            generator.appendInteger(1, 64);
+        }
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
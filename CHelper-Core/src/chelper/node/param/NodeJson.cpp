@@ -14,11 +14,9 @@ namespace CHelper::Node {
           key(std::move(key)) {}
 
     void NodeJson::init(const CPack &cpack) {
-        for (const auto &item: cpack.jsonNodes) {
-            if (HEDLEY_UNLIKELY(item->id == key)) {
-                nodeJson = item.get();
-                return;
-            }
+        nodeJson = cpack.getJsonNode(key);
+        if (HEDLEY_LIKELY(nodeJson != nullptr)) {
+            return;
         }
         Profile::push("linking contents to {}", key);
         Profile::push("failed to find json data in the cpack -> {}", key);
@@ -39,4 +37,8 @@ namespace CHelper::Node {
         structure.append(isMustHave, description.value_or(u"JSON文本"));
     }
 
+    void NodeJson::generate(CommandGenerator &generator) const {
+        nodeJson->generate(generator);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
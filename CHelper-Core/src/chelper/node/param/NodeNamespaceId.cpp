@@ -30,6 +30,16 @@ namespace CHelper::Node {
                 throw std::runtime_error("missing content");
             }
         }
+        if (HEDLEY_LIKELY(!contents.has_value() && key.has_value())) {
+            customContentsSet = cpack.getNamespaceIdSet(key.value());
+            customContentsIndex = cpack.getNamespaceIdIndex(key.value());
+        }
+        if (HEDLEY_UNLIKELY(customContentsSet == nullptr)) {
+            customContentsSet = std::make_shared<IdSet>(*customContents);
+        }
+        if (HEDLEY_UNLIKELY(customContentsIndex == nullptr)) {
+            customContentsIndex = std::make_shared<NamespaceIdIndex>(customContents);
+        }
     }
 
     NodeTypeId::NodeTypeId NodeNamespaceId::getNodeType() const {
@@ -44,16 +54,13 @@ namespace CHelper::Node {
         DEBUG_GET_NODE_END(this)
         if (HEDLEY_UNLIKELY(result.tokens.isEmpty())) {
             TokensView tokens = result.tokens;
-            return ASTNode::andNode(this, {std::move(result)}, tokens, ErrorReason::incomplete(tokens, u"命令不完整"));
+            return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(result)), tokens, ErrorReason::incomplete(tokens, u"命令不完整"));
         }
         if (HEDLEY_UNLIKELY(!ignoreError.value_or(false))) {
             TokensView tokens = result.tokens;
             std::u16string_view str = tokens.toString();
-            size_t strHash = std::hash<std::u16string_view>{}(str);
-            if (HEDLEY_UNLIKELY(std::all_of(customContents->begin(), customContents->end(), [&strHash](const auto &item) {
-                    return !item->fastMatch(strHash) && !item->getIdWithNamespace()->fastMatch(strHash);
-                }))) {
-                return ASTNode::andNode(this, {std::move(result)}, tokens, ErrorReason::incomplete(tokens, u"找不到含义 -> " + std::u16string(str)));
+            if (HEDLEY_UNLIKELY(!customContentsSet->contains(str))) {
+                return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(result)), tokens, ErrorReason::incomplete(tokens, u"找不到含义 -> " + std::u16string(str)));
             }
         }
         return result;
@@ -65,10 +72,7 @@ namespace CHelper::Node {
             return true;
         }
         std::u16string_view str = astNode->tokens.toString();
-        size_t strHash = std::hash<std::u16string_view>{}(str);
-        if (HEDLEY_UNLIKELY(std::all_of(customContents->begin(), customContents->end(), [&strHash](const auto &item) {
-                return !item->fastMatch(strHash) && !item->getIdWithNamespace()->fastMatch(strHash);
-            }))) {
+        if (HEDLEY_UNLIKELY(!customContentsSet->contains(str))) {
             idErrorReasons.push_back(ErrorReason::idError(astNode->tokens, std::u16string(u"找不到ID -> ").append(str)));
         }
         return true;
@@ -77,76 +81,37 @@ namespace CHelper::Node {
     bool NodeNamespaceId::collectSuggestions(const ASTNode *astNode,
                                              size_t index,
                                              std::vector<Suggestions> &suggestions) const {
-        KMPMatcher kmpMatcher(astNode->tokens.toString().substr(0, index - astNode->tokens.getStartIndex()));
-        std::vector<std::shared_ptr<NormalId>> nameStartOf, nameContain;
-        std::vector<std::shared_ptr<NormalId>> namespaceStartOf, namespaceContain;
-        std::vector<std::shared_ptr<NamespaceId>> descriptionContain;
-        for (const auto &item: *customContents) {
-            //通过名字进行搜索
-            //省略minecraft命名空间
-            if (HEDLEY_LIKELY((!item->idNamespace.has_value() || item->idNamespace.value() == u"minecraft"))) {
-                size_t index1 = kmpMatcher.match(item->name);
-                if (HEDLEY_UNLIKELY(index1 == 0)) {
-                    nameStartOf.push_back(item);
-                } else if (HEDLEY_UNLIKELY(index1 != std::u16string::npos)) {
-                    nameContain.push_back(item);
-                }
-            }
-            //带有命名空间
-            size_t index1 = kmpMatcher.match(item->getIdWithNamespace()->name);
-            if (HEDLEY_UNLIKELY(index1 != std::u16string::npos)) {
-                if (HEDLEY_UNLIKELY(index1 == 0)) {
-                    namespaceStartOf.push_back(item->getIdWithNamespace());
-                } else {
-                    namespaceContain.push_back(item->getIdWithNamespace());
-                }
-                continue;
-            }
-            //通过介绍进行搜索
-            if (HEDLEY_UNLIKELY(
-                        item->description.has_value() && kmpMatcher.match(item->description.value()) != std::u16string::npos)) {
-                descriptionContain.push_back(item);
+        std::u16string_view str = astNode->tokens.toString().substr(0, index - astNode->tokens.getStartIndex());
+        std::vector<uint32_t> nameStartOf, nameContain;
+        std::vector<uint32_t> namespaceStartOf, namespaceContain;
+        std::vector<uint32_t> descriptionContain;
+        customContentsIndex->search(str, nameStartOf, nameContain, namespaceStartOf, namespaceContain, descriptionContain);
+        // 只记录ID的下标和是否带有命名空间，获取补全提示时才创建
+        auto ids = std::make_shared<std::vector<std::pair<uint32_t, bool>>>();
+        ids->reserve(nameStartOf.size() + nameContain.size() +
+                     namespaceStartOf.size() + namespaceContain.size() +
+                     2 * descriptionContain.size());
+        auto append = [&ids](const std::vector<uint32_t> &items, bool isWithNamespace) {
+            for (uint32_t item: items) {
+                ids->emplace_back(item, isWithNamespace);
             }
-        }
-        Suggestions suggestions1(SuggestionsType::ID);
-        ;
-        suggestions1.suggestions.reserve(nameStartOf.size() + nameContain.size() +
-                                         namespaceStartOf.size() + namespaceContain.size() +
-                                         2 * descriptionContain.size());
-        size_t start = astNode->tokens.getStartIndex();
-        size_t end = astNode->tokens.getEndIndex();
-        std::transform(nameStartOf.begin(), nameStartOf.end(),
-                       std::back_inserter(suggestions1.suggestions),
-                       [&start, &end, this](const auto &item) {
-                           return Suggestion(start, end, isAfterWhitespace(), item);
-                       });
-        std::transform(nameContain.begin(), nameContain.end(),
-                       std::back_inserter(suggestions1.suggestions),
-                       [&start, &end, this](const auto &item) {
-                           return Suggestion(start, end, isAfterWhitespace(), item);
-                       });
-        std::transform(namespaceStartOf.begin(), namespaceStartOf.end(),
-                       std::back_inserter(suggestions1.suggestions),
-                       [&start, &end, this](const auto &item) {
-                           return Suggestion(start, end, isAfterWhitespace(), item);
-                       });
-        std::transform(namespaceContain.begin(), namespaceContain.end(),
-                       std::back_inserter(suggestions1.suggestions),
-                       [&start, &end, this](const auto &item) {
-                           return Suggestion(start, end, isAfterWhitespace(), item);
-                       });
-        std::transform(descriptionContain.begin(), descriptionContain.end(),
-                       std::back_inserter(suggestions1.suggestions),
-                       [&start, &end, this](const auto &item) {
-                           return Suggestion(start, end, isAfterWhitespace(), item);
-                       });
-        std::transform(descriptionContain.begin(), descriptionContain.end(),
-                       std::back_inserter(suggestions1.suggestions),
-                       [&start, &end, this](const auto &item) {
-                           return Suggestion(start, end, isAfterWhitespace(), item->getIdWithNamespace());
-                       });
-        suggestions1.markFiltered();
-        suggestions.push_back(std::move(suggestions1));
+        };
+        append(nameStartOf, false);
+        append(nameContain, false);
+        append(namespaceStartOf, true);
+        append(namespaceContain, true);
+        append(descriptionContain, false);
+        append(descriptionContain, true);
+        size_t size = ids->size();
+        suggestions.push_back(Suggestions::lazyIdSuggestions(
+                astNode->tokens.getStartIndex(), astNode->tokens.getEndIndex(), isAfterWhitespace(), size,
+                [contents = customContents, ids = std::move(ids)](size_t which) -> std::shared_ptr<NormalId> {
+                    const auto &[id, isWithNamespace] = (*ids)[which];
+                    if (HEDLEY_UNLIKELY(isWithNamespace)) {
+                        return contents->at(id)->getIdWithNamespace();
+                    }
+                    return contents->at(id);
+                }));
         return true;
     }
 
@@ -163,4 +128,17 @@ namespace CHelper::Node {
         return true;
     }
 
+    void NodeNamespaceId::generate(CommandGenerator &generator) const {
+        if (HEDLEY_UNLIKELY(customContents->empty())) {
+            generator.fail();
+            return;
+        }
+        const auto &content = generator.nextElement(*customContents);
+        if (HEDLEY_UNLIKELY(generator.nextBoolean(10))) {
+            generator.append(content->getIdWithNamespace()->name);
+        } else {
+            generator.append(content->name);
+        }
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
@@ -38,6 +38,8 @@ namespace CHelper::Node {
         }
 #endif
         customContents = contents;
+        customContentsSet = std::make_shared<IdSet>(*contents);
+        customContentsIndex = std::make_shared<NormalIdIndex>(contents);
     }
 
     void NodeNormalId::init(const CPack &cpack) {
@@ -60,6 +62,16 @@ namespace CHelper::Node {
                 throw std::runtime_error("missing content");
             }
         }
+        if (HEDLEY_LIKELY(!contents.has_value() && key.has_value())) {
+            customContentsSet = cpack.getNormalIdSet(key.value());
+            customContentsIndex = cpack.getNormalIdIndex(key.value());
+        }
+        if (HEDLEY_UNLIKELY(customContentsSet == nullptr)) {
+            customContentsSet = std::make_shared<IdSet>(*customContents);
+        }
+        if (HEDLEY_UNLIKELY(customContentsIndex == nullptr)) {
+            customContentsIndex = std::make_shared<NormalIdIndex>(customContents);
+        }
     }
 
     NodeTypeId::NodeTypeId NodeNormalId::getNodeType() const {
@@ -83,16 +95,13 @@ namespace CHelper::Node {
         tokenReader.pop();
         if (HEDLEY_UNLIKELY(result.tokens.isEmpty())) {
             TokensView tokens = result.tokens;
-            return ASTNode::andNode(this, {std::move(result)}, tokens, ErrorReason::incomplete(tokens, u"命令不完整"));
+            return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(result)), tokens, ErrorReason::incomplete(tokens, u"命令不完整"));
         }
         if (HEDLEY_UNLIKELY(!ignoreError.value_or(true))) {
             TokensView tokens = result.tokens;
             std::u16string_view str = tokens.toString();
-            size_t strHash = std::hash<std::u16string_view>{}(str);
-            if (HEDLEY_UNLIKELY(std::all_of(customContents->begin(), customContents->end(), [&strHash](const auto &item) {
-                    return !item->fastMatch(strHash);
-                }))) {
-                return ASTNode::andNode(this, {std::move(result)}, tokens, ErrorReason::incomplete(tokens, u"找不到含义 -> " + std::u16string(str)));
+            if (HEDLEY_UNLIKELY(!customContentsSet->contains(str))) {
+                return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(result)), tokens, ErrorReason::incomplete(tokens, u"找不到含义 -> " + std::u16string(str)));
             }
         }
         return result;
@@ -104,10 +113,7 @@ namespace CHelper::Node {
             return true;
         }
         std::u16string_view str = astNode->tokens.toString();
-        size_t strHash = std::hash<std::u16string_view>{}(str);
-        if (HEDLEY_UNLIKELY(std::all_of(customContents->begin(), customContents->end(), [&strHash](const auto &item) {
-                return !item->fastMatch(strHash);
-            }))) {
+        if (HEDLEY_UNLIKELY(!customContentsSet->contains(str))) {
             idErrorReasons.push_back(ErrorReason::idError(astNode->tokens, std::u16string(u"找不到ID -> ").append(str)));
         }
         return true;
@@ -116,46 +122,20 @@ namespace CHelper::Node {
     bool NodeNormalId::collectSuggestions(const ASTNode *astNode,
                                           size_t index,
                                           std::vector<Suggestions> &suggestions) const {
-        KMPMatcher kmpMatcher(astNode->tokens.toString().substr(0, index - astNode->tokens.getStartIndex()));
-        std::vector<std::shared_ptr<NormalId>> nameStartOf, nameContain, descriptionContain;
-        for (const auto &item: *customContents) {
-            //通过名字进行搜索
-            size_t index1 = kmpMatcher.match(item->name);
-            if (HEDLEY_UNLIKELY(index1 != std::u16string::npos)) {
-                if (HEDLEY_UNLIKELY(index1 == 0)) {
-                    nameStartOf.push_back(item);
-                } else {
-                    nameContain.push_back(item);
-                }
-                continue;
-            }
-            //通过介绍进行搜索
-            if (HEDLEY_UNLIKELY(
-                        item->description.has_value() && kmpMatcher.match(item->description.value()) != std::u16string::npos)) {
-                descriptionContain.push_back(item);
-            }
-        }
-        Suggestions suggestions1(SuggestionsType::ID);
-        suggestions1.suggestions.reserve(nameStartOf.size() + nameContain.size() + descriptionContain.size());
-        size_t start = astNode->tokens.getStartIndex();
-        size_t end = astNode->tokens.getEndIndex();
-        std::transform(nameStartOf.begin(), nameStartOf.end(),
-                       std::back_inserter(suggestions1.suggestions),
-                       [&start, &end, this](const auto &item) {
-                           return Suggestion(start, end, isAfterWhitespace(), item);
-                       });
-        std::transform(nameContain.begin(), nameContain.end(),
-                       std::back_inserter(suggestions1.suggestions),
-                       [&start, &end, this](const auto &item) {
-                           return Suggestion(start, end, isAfterWhitespace(), item);
-                       });
-        std::transform(descriptionContain.begin(), descriptionContain.end(),
-                       std::back_inserter(suggestions1.suggestions),
-                       [&start, &end, this](const auto &item) {
-                           return Suggestion(start, end, isAfterWhitespace(), item);
-                       });
-        suggestions1.markFiltered();
-        suggestions.push_back(std::move(suggestions1));
+        std::u16string_view str = astNode->tokens.toString().substr(0, index - astNode->tokens.getStartIndex());
+        std::vector<uint32_t> nameStartOf, nameContain, descriptionContain;
+        customContentsIndex->search(str, nameStartOf, nameContain, descriptionContain);
+        // 只记录ID的下标，获取补全提示时才创建
+        auto ids = std::make_shared<std::vector<uint32_t>>(std::move(nameStartOf));
+        ids->reserve(ids->size() + nameContain.size() + descriptionContain.size());
+        ids->insert(ids->end(), nameContain.begin(), nameContain.end());
+        ids->insert(ids->end(), descriptionContain.begin(), descriptionContain.end());
+        size_t size = ids->size();
+        suggestions.push_back(Suggestions::lazyIdSuggestions(
+                astNode->tokens.getStartIndex(), astNode->tokens.getEndIndex(), isAfterWhitespace(), size,
+                [contents = customContents, ids = std::move(ids)](size_t which) {
+                    return contents->at((*ids)[which]);
+                }));
         return true;
     }
 
@@ -178,4 +158,14 @@ namespace CHelper::Node {
         return true;
     }
 
+    void NodeNormalId::generate(CommandGenerator &generator) const {
+        if (HEDLEY_UNLIKELY(customContents->empty())) {
+            if (HEDLEY_UNLIKELY(!allowMissingID)) {
+                generator.fail();
+            }
+            return;
+        }
+        generator.append(generator.nextElement(*customContents)->name);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
@@ -10,14 +10,55 @@
 namespace CHelper::Node {
 
     void NodePerCommand::init(const CPack &cpack) {
-        for (const auto &item: nodes) {
-            if (HEDLEY_LIKELY(item->id.has_value())) {
-                Profile::push(R"(init node {}: "{}")", NodeTypeHelper::getName(item->getNodeType()), item->id.value());
-            } else {
-                Profile::push("init node {}", NodeTypeHelper::getName(item->getNodeType()));
+        if (HEDLEY_LIKELY(lazyData != nullptr)) {
+            lazyCPack = &cpack;
+            return;
+        }
+        initNodes(cpack);
+    }
+
+    /**
+     * 加载延迟加载的命令节点，可以被多个线程同时调用
+     */
+    void NodePerCommand::load() const {
+        std::call_once(lazyLoadFlag, [this]() {
+            if (HEDLEY_LIKELY(lazyData == nullptr)) {
+                return;
+            }
+            // 对于外部来说，加载前后命令的内容是一样的
+            auto *self = const_cast<NodePerCommand *>(this);
+            CHELPER_TRACE_SCOPE_ARGS("NodePerCommand::load", "{}", name[0]);
+            Profile::push(R"(lazy loading command: "{}")", StringUtil::join(u",", name));
+            MemoryStreamBuffer buffer(lazyData, lazySize);
+            std::istream istream(&buffer);
+            currentCreateStage = NodeCreateStage::COMMAND_PARAM_NODE;
+            // 二进制资源包总是使用isNeedConvert=true读写
+            serialization::Codec<NodePerCommand>::template body_from_binary<true>(istream, *self);
+            currentCreateStage = NodeCreateStage::NONE;
+            self->lazyData = nullptr;
+            self->lazySize = 0;
+            self->lazyOwner = nullptr;
+            if (HEDLEY_LIKELY(lazyCPack != nullptr)) {
+                self->initNodes(*lazyCPack);
             }
-            item->init(cpack);
             Profile::pop();
+        });
+    }
+
+    void NodePerCommand::initNodes(const CPack &cpack) {
+        // 只有出现异常时才把节点的信息加入Profile的栈中，正常初始化时不需要格式化字符串
+        for (const auto &item: nodes) {
+            size_t stackSize = Profile::stack.size();
+            try {
+                item->init(cpack);
+            } catch (...) {
+                if (HEDLEY_LIKELY(item->id.has_value())) {
+                    Profile::insert(stackSize, R"(init node {}: "{}")", NodeTypeHelper::getName(item->getNodeType()), item->id.value());
+                } else {
+                    Profile::insert(stackSize, "init node {}", NodeTypeHelper::getName(item->getNodeType()));
+                }
+                throw;
+            }
         }
         for (const auto &item: nodes) {
             if (HEDLEY_UNLIKELY(item->nextNodes.empty())) {
@@ -54,6 +95,7 @@ namespace CHelper::Node {
     }
 
     ASTNode NodePerCommand::getASTNode(TokenReader &tokenReader, const CPack *cpack) const {
+        load();
         std::vector<ASTNode> childASTNodes;
         childASTNodes.reserve(startNodes.size());
         for (const auto &item: startNodes) {
@@ -73,4 +115,14 @@ namespace CHelper::Node {
         return std::nullopt;
     }
 
+    void NodePerCommand::generate(CommandGenerator &generator) const {
+        load();
+        if (HEDLEY_UNLIKELY(startNodes.empty())) {
+            generator.fail();
+            return;
+        }
+        const NodeBase *startNode = generator.nextElement(startNodes);
+        startNode->generateWithNextNodes(generator, startNode->getNodeType() != NodeTypeId::REPEAT);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
@@ -26,7 +26,7 @@ namespace CHelper::Node {
             if (threeChildNodes.empty() && node.second.isError() && !node.second.tokens.isEmpty()) {
                 tokenReader.pop();
                 TokensView tokens = node.second.tokens;
-                return ASTNode::andNode(this, {std::move(node.second)}, tokens, nullptr, ASTNodeId::NODE_POSITION_POSITIONS);
+                return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(node.second)), tokens, nullptr, ASTNodeId::NODE_POSITION_POSITIONS);
             }
             type = node.first;
             threeChildNodes.push_back(std::move(node.second));
@@ -42,7 +42,7 @@ namespace CHelper::Node {
                 }
             }
             if (count == 1 || count == 2) {
-                return ASTNode::andNode(this, {std::move(result)}, tokens, nullptr, ASTNodeId::NODE_POSITION_POSITIONS_WITH_ERROR);
+                return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(result)), tokens, nullptr, ASTNodeId::NODE_POSITION_POSITIONS_WITH_ERROR);
             }
         }
         return std::move(result);
@@ -91,4 +91,22 @@ namespace CHelper::Node {
         }
     }
 
+    void NodePosition::generate(CommandGenerator &generator) const {
+        // 局部坐标不能和其他坐标混用
+        bool isCaret = generator.nextBoolean(20);
+        for (size_t i = 0; i < 3; ++i) {
+            if (HEDLEY_LIKELY(i > 0)) {
+                generator.append(u' ');
+            }
+            if (HEDLEY_UNLIKELY(isCaret)) {
+                generator.append(u'^');
+                if (HEDLEY_UNLIKELY(generator.nextBoolean(30))) {
+                    generator.appendFloat(-10, 10);
+                }
+            } else {
+                NodeRelativeFloat::generate(generator, false);
+            }
+        }
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
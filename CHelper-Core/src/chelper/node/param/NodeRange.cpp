@@ -85,10 +85,31 @@ namespace CHelper::Node {
         for (int i = 0; i < str.length(); ++i) {
             size_t ch = str[i];
             coloredString.setColor(
-                    astNode->tokens.startIndex + i,
+                    astNode->tokens.getStartIndex() + i,
                     (ch < '0' || ch > '9') && ch != '-' && ch != '+' ? theme.colorRange : theme.colorInteger);
         }
         return true;
     }
 
+    void NodeRange::generate(CommandGenerator &generator) const {
+        switch (generator.nextIndex(4)) {
+            case 0:
+                generator.appendInteger(-10, 10);
+                break;
+            case 1:
+                generator.appendInteger(-10, 10);
+                generator.append(u"..");
+                break;
+            case 2:
+                generator.append(u"..");
+                generator.appendInteger(-10, 10);
+                break;
+            default:
+                generator.appendInteger(-10, 0);
+                generator.append(u"..");
+                generator.appendInteger(0, 10);
+                break;
+        }
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
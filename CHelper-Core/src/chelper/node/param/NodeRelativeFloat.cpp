@@ -33,7 +33,7 @@ namespace CHelper::Node {
         }
         if (HEDLEY_UNLIKELY(!canUseCaretNotation && result.first == 2)) {
             TokensView tokens = result.second.tokens;
-            return ASTNode::andNode(this, {std::move(result.second)}, tokens, nullptr, ASTNodeId::NODE_RELATIVE_FLOAT_WITH_ERROR);
+            return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(result.second)), tokens, nullptr, ASTNodeId::NODE_RELATIVE_FLOAT_WITH_ERROR);
         }
         return result.second;
     }
@@ -56,7 +56,7 @@ namespace CHelper::Node {
         // 0 - 绝对坐标，1 - 相对坐标，2 - 局部坐标
         uint8_t type;
         tokenReader.push();
-        ASTNode preSymbol = nodePreSymbol->getASTNode(tokenReader, cpack);
+        ASTNode preSymbol = dispatchASTNode(nodePreSymbol.get(), tokenReader, cpack);
         if (HEDLEY_UNLIKELY(preSymbol.isError())) {
             type = 0;
             tokenReader.restore();
@@ -90,7 +90,7 @@ namespace CHelper::Node {
         childNodes.push_back(std::move(number));
         ASTNode result = ASTNode::andNode(node, std::move(childNodes), tokenReader.collect(), errorReason);
         // 为了获取补全提示，再嵌套一层or节点
-        return {type, ASTNode::orNode(node, {std::move(result), std::move(preSymbol)}, nullptr)};
+        return {type, ASTNode::orNode(node, ASTNode::makeChildNodes(std::move(result), std::move(preSymbol)), nullptr)};
     }
 
     bool NodeRelativeFloat::collectSuggestions(const ASTNode *astNode, size_t index, std::vector<Suggestions> &suggestions) const {
@@ -136,4 +136,22 @@ namespace CHelper::Node {
         }
     }
 
+    void NodeRelativeFloat::generate(CommandGenerator &generator) const {
+        generate(generator, canUseCaretNotation);
+    }
+
+    void NodeRelativeFloat::generate(CommandGenerator &generator, bool canUseCaretNotation) {
+        if (HEDLEY_UNLIKELY(canUseCaretNotation && generator.nextBoolean(20))) {
+            generator.append(u'^');
+        } else if (HEDLEY_LIKELY(generator.nextBoolean())) {
+            generator.append(u'~');
+        } else {
+            generator.appendFloat(-100, 100);
+            return;
+        }
+        if (HEDLEY_UNLIKELY(generator.nextBoolean(30))) {
+            generator.appendFloat(-10, 10);
+        }
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
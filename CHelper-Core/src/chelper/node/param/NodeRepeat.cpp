@@ -4,14 +4,15 @@
 
 #include <chelper/node/param/NodeRepeat.h>
 #include <chelper/node/util/NodeAnd.h>
+#include <chelper/node/util/NodeOr.h>
 
 namespace CHelper::Node {
 
     void NodeRepeat::init(const CPack &cpack) {
-        const auto &it = cpack.repeatNodes.find(key);
-        if (HEDLEY_LIKELY(it != cpack.repeatNodes.end())) {
-            repeatData = it->second.first;
-            nodeElement = it->second.second;
+        auto repeatNode = cpack.getRepeatNode(key);
+        if (HEDLEY_LIKELY(repeatNode.first != nullptr)) {
+            repeatData = repeatNode.first;
+            nodeElement = repeatNode.second;
             return;
         }
         Profile::push("link repeat data {} to content", key);
@@ -27,7 +28,7 @@ namespace CHelper::Node {
         tokenReader.push();
         std::vector<ASTNode> childNodes;
         while (true) {
-            ASTNode orNode = nodeElement->getASTNode(tokenReader, cpack);
+            ASTNode orNode = dispatchASTNode(nodeElement, tokenReader, cpack);
             bool isAstNodeError = orNode.childNodes[0].isError();
             bool isBreakAstNodeError = orNode.childNodes[1].isError();
             if (HEDLEY_UNLIKELY(!isBreakAstNodeError || isAstNodeError ||
@@ -86,4 +87,14 @@ namespace CHelper::Node {
         structure.isDirty = true;
     }
 
+    void NodeRepeat::generate(CommandGenerator &generator) const {
+        // 和CPack中创建的节点结构相同：第一个子节点是可以重复的部分，第二个子节点是结束重复的部分
+        const auto *orNode = reinterpret_cast<const NodeOr *>(nodeElement);
+        size_t count = generator.isTooDeep() ? 0 : generator.nextIndex(3);
+        for (size_t i = 0; i < count; ++i) {
+            orNode->childNodes[0]->generate(generator);
+        }
+        orNode->childNodes[1]->generate(generator);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
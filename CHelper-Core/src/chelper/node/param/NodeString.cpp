@@ -103,4 +103,28 @@ namespace CHelper::Node {
         return true;
     }
 
+    void NodeString::generate(CommandGenerator &generator) const {
+        if (HEDLEY_UNLIKELY(allowMissingString && generator.nextBoolean(10))) {
+            return;
+        }
+        if (HEDLEY_UNLIKELY(ignoreLater)) {
+            //后面的所有内容都算作这个字符串，可以包含空格
+            generator.appendWord();
+            while (generator.nextBoolean(30)) {
+                generator.append(u' ');
+                generator.appendWord();
+            }
+            return;
+        }
+        if (HEDLEY_UNLIKELY(canContainSpace && generator.nextBoolean(20))) {
+            generator.append(u'"');
+            generator.appendWord();
+            generator.append(u' ');
+            generator.appendWord();
+            generator.append(u'"');
+            return;
+        }
+        generator.appendWord();
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
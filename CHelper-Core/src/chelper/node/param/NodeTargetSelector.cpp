@@ -258,11 +258,11 @@ namespace CHelper::Node {
         tokenReader.restore();
         if (HEDLEY_LIKELY(leftBracket.isError())) {
             //没有后面的[...]
-            return ASTNode::andNode(this, {targetSelectorVariable}, tokenReader.collect(),
+            return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(targetSelectorVariable)), tokenReader.collect(),
                                     nullptr, ASTNodeId::NODE_TARGET_SELECTOR_NO_ARGUMENTS);
         }
         ASTNode arguments = nodeArguments->getASTNodeWithNextNode(tokenReader, cpack);
-        return ASTNode::andNode(this, {targetSelectorVariable, arguments}, tokenReader.collect(),
+        return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(targetSelectorVariable), std::move(arguments)), tokenReader.collect(),
                                 nullptr, ASTNodeId::NODE_TARGET_SELECTOR_WITH_ARGUMENTS);
     }
 
@@ -293,4 +293,26 @@ namespace CHelper::Node {
         structure.append(isMustHave, u"目标选择器");
     }
 
+    void NodeTargetSelector::generate(CommandGenerator &generator) const {
+        if (HEDLEY_UNLIKELY(isWildcard && generator.nextBoolean(10))) {
+            generator.append(u'*');
+            return;
+        }
+        if (HEDLEY_UNLIKELY(generator.nextBoolean(20))) {
+            nodePlayerName->generate(generator);
+            return;
+        }
+        static const std::vector<std::u16string> allVariables = {u"@a", u"@e", u"@p", u"@r", u"@s"};
+        static const std::vector<std::u16string> playerVariables = {u"@a", u"@p", u"@s"};
+        static const std::vector<std::u16string> onlyOneVariables = {u"@p", u"@r", u"@s"};
+        static const std::vector<std::u16string> onlyOnePlayerVariables = {u"@p", u"@s"};
+        const std::vector<std::u16string> &variables =
+                isOnlyOne ? (isMustPlayer ? onlyOnePlayerVariables : onlyOneVariables)
+                          : (isMustPlayer ? playerVariables : allVariables);
+        generator.append(generator.nextElement(variables));
+        if (HEDLEY_UNLIKELY(!generator.isTooDeep() && generator.nextBoolean(30))) {
+            nodeArguments->generate(generator);
+        }
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
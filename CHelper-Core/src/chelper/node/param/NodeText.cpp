@@ -35,9 +35,9 @@ namespace CHelper::Node {
         if (HEDLEY_UNLIKELY(str != data->name)) {
             TokensView tokens = result.tokens;
             if (HEDLEY_UNLIKELY(str.empty())) {
-                return ASTNode::andNode(this, {std::move(result)}, tokens, ErrorReason::contentError(tokens, u"命令不完整"));
+                return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(result)), tokens, ErrorReason::contentError(tokens, u"命令不完整"));
             } else {
-                return ASTNode::andNode(this, {std::move(result)}, tokens, ErrorReason::contentError(tokens, u"找不到含义 -> " + std::u16string(str)));
+                return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(result)), tokens, ErrorReason::contentError(tokens, u"找不到含义 -> " + std::u16string(str)));
             }
         }
         return result;
@@ -81,4 +81,8 @@ namespace CHelper::Node {
         return true;
     }
 
+    void NodeText::generate(CommandGenerator &generator) const {
+        generator.append(data->name);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
@@ -50,4 +50,14 @@ namespace CHelper::Node {
         return std::nullopt;
     }
 
+    void NodeAnd::generate(CommandGenerator &generator) const {
+        for (int i = 0; i < childNodes.size(); ++i) {
+            const auto &item = childNodes[i];
+            item->generateWithNextNodes(
+                    generator,
+                    whitespaceMode == WhitespaceMode::NORMAL &&
+                            (i == 0 || childNodes[i - 1]->isAfterWhitespace() || item->isAfterWhitespace()));
+        }
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
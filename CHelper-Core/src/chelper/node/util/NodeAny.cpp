@@ -71,25 +71,23 @@ namespace CHelper::Node {
         return NodeTypeId::ANY;
     }
 
-    void NodeAny::init(const CPack &cpack) {
-        if (HEDLEY_UNLIKELY(node == nullptr)) {
-            node = std::make_unique<NodeOr>(
-                    u"VALUE", u"目标选择器参数值",
-                    std::vector<const NodeBase *>{
-                            nodeRelativeFloat.get(), nodeBoolean.get(),
-                            nodeString.get(), nodeObject.get(),
-                            nodeRange.get(), nodeList.get()},
-                    false);
-        }
+    /**
+     * 所有NodeAny共用同一个值节点，第一次使用时创建，局部静态变量的初始化是线程安全的。
+     * 不能在静态变量初始化时创建，因为nodeEntry和nodeList在初始化时就需要NodeAny。
+     */
+    static const NodeBase *getNodeValue() {
+        static std::unique_ptr<NodeBase> node = std::make_unique<NodeOr>(
+                u"VALUE", u"目标选择器参数值",
+                std::vector<const NodeBase *>{
+                        nodeRelativeFloat.get(), nodeBoolean.get(),
+                        nodeString.get(), nodeObject.get(),
+                        nodeRange.get(), nodeList.get()},
+                false);
+        return node.get();
     }
 
     ASTNode NodeAny::getASTNode(TokenReader &tokenReader, const CPack *cpack) const {
-#ifdef CHelperDebug
-        if (HEDLEY_UNLIKELY(node == nullptr)) {
-            throw std::runtime_error("not init");
-        }
-#endif
-        return getByChildNode(tokenReader, cpack, node.get());
+        return getByChildNode(tokenReader, cpack, getNodeValue());
     }
 
     NodeAny *NodeAny::getNodeAny() {
@@ -97,4 +95,8 @@ namespace CHelper::Node {
         return node.get();
     }
 
+    void NodeAny::generate(CommandGenerator &generator) const {
+        getNodeValue()->generate(generator);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
@@ -43,4 +43,10 @@ namespace CHelper::Node {
         return std::nullopt;
     }
 
+    void NodeEntry::generate(CommandGenerator &generator) const {
+        nodeKey->generateWithNextNodes(generator);
+        nodeSeparator->generateWithNextNodes(generator);
+        nodeValue->generateWithNextNodes(generator);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
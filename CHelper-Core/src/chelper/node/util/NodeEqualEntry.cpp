@@ -80,7 +80,6 @@ namespace CHelper::Node {
         }
         //value
         if (HEDLEY_UNLIKELY(it == equalDatas.end())) {
-            NodeAny::getNodeAny()->init(*cpack);
             childNodes.push_back(NodeAny::getNodeAny()->getASTNodeWithNextNode(tokenReader, cpack));
         } else {
             childNodes.push_back(it->nodeValue->getASTNodeWithNextNode(tokenReader, cpack));
@@ -88,4 +87,15 @@ namespace CHelper::Node {
         return ASTNode::andNode(this, std::move(childNodes), tokenReader.collect());
     }
 
+    void NodeEqualEntry::generate(CommandGenerator &generator) const {
+        if (HEDLEY_UNLIKELY(equalDatas.empty())) {
+            generator.fail();
+            return;
+        }
+        const EqualData &equalData = generator.nextElement(equalDatas);
+        generator.append(equalData.name);
+        generator.append(equalData.canUseNotEqual && generator.nextBoolean(20) ? u"=!" : u"=");
+        equalData.nodeValue->generateWithNextNodes(generator);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
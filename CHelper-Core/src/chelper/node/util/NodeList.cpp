@@ -45,7 +45,7 @@ namespace CHelper::Node {
         tokenReader.push();
         ASTNode left = nodeLeft->getASTNodeWithNextNode(tokenReader, cpack);
         if (HEDLEY_UNLIKELY(left.isError())) {
-            return ASTNode::andNode(this, {std::move(left)}, tokenReader.collect());
+            return ASTNode::andNode(this, ASTNode::makeChildNodes(std::move(left)), tokenReader.collect());
         }
         std::vector<ASTNode> childNodes = {std::move(left)};
         {
@@ -111,4 +111,16 @@ namespace CHelper::Node {
         return std::nullopt;
     }
 
+    void NodeList::generate(CommandGenerator &generator) const {
+        nodeLeft->generateWithNextNodes(generator);
+        size_t count = generator.isTooDeep() ? 0 : generator.nextIndex(3);
+        for (size_t i = 0; i < count; ++i) {
+            if (HEDLEY_LIKELY(i > 0)) {
+                nodeSeparator->generateWithNextNodes(generator);
+            }
+            nodeElement->generateWithNextNodes(generator);
+        }
+        nodeRight->generateWithNextNodes(generator);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
@@ -43,7 +43,7 @@ namespace CHelper::Node {
         }
         for (const auto &item: childNodes) {
             tokenReader.push();
-            ASTNode node = item->getASTNode(tokenReader, cpack);
+            ASTNode node = dispatchASTNode(item, tokenReader, cpack);
             bool isNodeError = node.isError();
             childASTNodes.push_back(std::move(node));
             indexes.push_back(tokenReader.index);
@@ -74,4 +74,12 @@ namespace CHelper::Node {
         return noSuggestion;
     }
 
+    void NodeOr::generate(CommandGenerator &generator) const {
+        if (HEDLEY_UNLIKELY(childNodes.empty())) {
+            generator.fail();
+            return;
+        }
+        generator.nextElement(childNodes)->generate(generator);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
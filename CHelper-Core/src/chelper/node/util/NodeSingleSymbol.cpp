@@ -59,4 +59,8 @@ namespace CHelper::Node {
         return true;
     }
 
+    void NodeSingleSymbol::generate(CommandGenerator &generator) const {
+        generator.append(symbol);
+    }
+
 }// namespace CHelper::Node
\ No newline at end of file
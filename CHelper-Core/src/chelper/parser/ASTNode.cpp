@@ -5,6 +5,7 @@
 #include <chelper/node/NodeBase.h>
 #include <chelper/node/param/NodeLF.h>
 #include <chelper/parser/ASTNode.h>
+#include <chelper/parser/CursorIndex.h>
 #include <chelper/parser/Suggestions.h>
 
 namespace CHelper {
@@ -13,14 +14,14 @@ namespace CHelper {
                      const Node::NodeBase *node,
                      std::vector<ASTNode> &&childNodes,
                      TokensView tokens,
-                     const std::vector<std::shared_ptr<ErrorReason>> &errorReasons,
+                     std::vector<std::shared_ptr<ErrorReason>> errorReasons,
                      ASTNodeId::ASTNodeId id,
                      size_t whichBest)
         : mode(mode),
           node(node),
           childNodes(std::move(childNodes)),
           tokens(std::move(tokens)),
-          errorReasons(errorReasons),
+          errorReasons(std::move(errorReasons)),
           id(id),
           whichBest(whichBest) {}
 
@@ -141,7 +142,7 @@ namespace CHelper {
         if (HEDLEY_LIKELY(errorReason != nullptr)) {
             errorReasons.push_back(errorReason);
         }
-        return {ASTNodeMode::NONE, node, {}, tokens, errorReasons, id};
+        return {ASTNodeMode::NONE, node, {}, tokens, std::move(errorReasons), id};
     }
 
     ASTNode ASTNode::andNode(const Node::NodeBase *node,
@@ -223,7 +224,7 @@ namespace CHelper {
         if (HEDLEY_UNLIKELY(errorCount > 1 && errorReason != nullptr)) {
             errorReasons = {ErrorReason::contentError(tokens1, errorReason)};
         }
-        return {ASTNodeMode::OR, node, std::move(childNodes), tokens1, errorReasons, id, whichBest};
+        return {ASTNodeMode::OR, node, std::move(childNodes), tokens1, std::move(errorReasons), id, whichBest};
     }
 
     ASTNode ASTNode::orNode(const Node::NodeBase *node,
@@ -234,6 +235,16 @@ namespace CHelper {
         return orNode(node, std::move(childNodes), &tokens, errorReason, id);
     }
 
+    void ASTNode::dropLosingChildNodes() {
+        if (HEDLEY_LIKELY(mode != ASTNodeMode::OR || childNodes.size() <= 1)) {
+            return;
+        }
+        ASTNode bestNode = std::move(childNodes[whichBest]);
+        childNodes.clear();
+        childNodes.push_back(std::move(bestNode));
+        whichBest = 0;
+    }
+
     bool ASTNode::isAllWhitespaceError() const {
         return isError() && std::all_of(errorReasons.begin(), errorReasons.end(),
                                         [](const auto &item) {
@@ -416,11 +427,12 @@ namespace CHelper {
         }
     }
 
-    std::u16string ASTNode::getDescription(size_t index) const {
+    std::u16string ASTNode::getDescription(size_t index, const CursorIndex *cursorIndex) const {
 #ifdef CHelperTest 
         Profile::push("start getting description: {}", std::u16string(tokens.toString()));
 #endif
-        auto result = collectDescription(index).value_or(u"未知");
+        auto description = cursorIndex == nullptr ? collectDescription(index) : cursorIndex->collectDescription(index);
+        auto result = description.value_or(u"未知");
 #ifdef CHelperTest 
         Profile::pop();
 #endif
@@ -492,7 +504,7 @@ namespace CHelper {
         }
     }
 
-    std::vector<Suggestion> ASTNode::getSuggestions(size_t index) const {
+    SuggestionList ASTNode::getSuggestionList(size_t index, const CursorIndex *cursorIndex) const {
         std::u16string_view str = tokens.toString();
 #ifdef CHelperTest 
         Profile::push("start getting suggestions: {}", str);
@@ -501,11 +513,19 @@ namespace CHelper {
         if (HEDLEY_UNLIKELY(canAddWhitespace0(*this, index))) {
             suggestions.push_back(Suggestions::singleWhitespaceSuggestion({str.length(), str.length(), false, whitespaceId}));
         }
-        collectSuggestions(index, suggestions);
+        if (HEDLEY_LIKELY(cursorIndex == nullptr)) {
+            collectSuggestions(index, suggestions);
+        } else {
+            cursorIndex->collectSuggestions(index, suggestions);
+        }
 #ifdef CHelperTest 
         Profile::pop();
 #endif
-        return Suggestions::filter(suggestions);
+        return SuggestionList(std::move(suggestions));
+    }
+
+    std::vector<Suggestion> ASTNode::getSuggestions(size_t index, const CursorIndex *cursorIndex) const {
+        return getSuggestionList(index, cursorIndex).getAll();
     }
 
     std::u16string ASTNode::getStructure() const {
@@ -542,13 +562,13 @@ namespace CHelper {
                     size_t indexOfColor = brackets.size() % 3;
                     switch (indexOfColor) {
                         case 0:
-                            coloredString.setColor(token.pos.index, theme.colorBrackets1);
+                            coloredString.setColor(token.index, theme.colorBrackets1);
                             break;
                         case 1:
-                            coloredString.setColor(token.pos.index, theme.colorBrackets2);
+                            coloredString.setColor(token.index, theme.colorBrackets2);
                             break;
                         case 2:
-                            coloredString.setColor(token.pos.index, theme.colorBrackets3);
+                            coloredString.setColor(token.index, theme.colorBrackets3);
                             break;
                         default:
                             HEDLEY_UNREACHABLE();
@@ -563,13 +583,13 @@ namespace CHelper {
                     size_t indexOfColor = (brackets.size() - 1) % 3;
                     switch (indexOfColor) {
                         case 0:
-                            coloredString.setColor(token.pos.index, theme.colorBrackets1);
+                            coloredString.setColor(token.index, theme.colorBrackets1);
                             break;
                         case 1:
-                            coloredString.setColor(token.pos.index, theme.colorBrackets2);
+                            coloredString.setColor(token.index, theme.colorBrackets2);
                             break;
                         case 2:
-                            coloredString.setColor(token.pos.index, theme.colorBrackets3);
+                            coloredString.setColor(token.index, theme.colorBrackets3);
                             break;
                         default:
                             HEDLEY_UNREACHABLE();
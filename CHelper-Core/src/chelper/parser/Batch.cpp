@@ -0,0 +1,54 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/parser/Batch.h>
+#include <chelper/parser/Parser.h>
+#include <chelper/util/Parallel.h>
+
+namespace CHelper::Batch {
+
+    //每次领取的行数，太小时线程之间争抢计数器，太大时最后几个线程会空等
+    static constexpr size_t CHUNK_SIZE = 64;
+
+    std::vector<std::u16string_view> splitLines(const std::u16string_view &content) {
+        std::vector<std::u16string_view> result;
+        size_t start = 0;
+        while (true) {
+            size_t end = content.find(u'\n', start);
+            std::u16string_view line = content.substr(start, end == std::u16string_view::npos ? std::u16string_view::npos : end - start);
+            if (HEDLEY_UNLIKELY(!line.empty() && line.back() == u'\r')) {
+                line.remove_suffix(1);
+            }
+            result.push_back(line);
+            if (HEDLEY_UNLIKELY(end == std::u16string_view::npos)) {
+                break;
+            }
+            start = end + 1;
+        }
+        return result;
+    }
+
+    static bool isSkipLine(const std::u16string_view &line) {
+        size_t index = line.find_first_not_of(u" \t");
+        return index == std::u16string_view::npos || line[index] == u'#';
+    }
+
+    std::vector<std::vector<std::shared_ptr<ErrorReason>>> validate(const CPack &cpack,
+                                                                    const std::vector<std::u16string_view> &lines,
+                                                                    size_t threads) {
+        std::vector<std::vector<std::shared_ptr<ErrorReason>>> result(lines.size());
+        // 每一行的结果写入自己的位置，不需要加锁，也不需要重新排序
+        Parallel::forEach(lines.size(), threads, CHUNK_SIZE, [&](size_t i) {
+            if (HEDLEY_UNLIKELY(isSkipLine(lines[i]))) {
+                return;
+            }
+            // 每个线程复用同一个字符串，避免每一行都重新分配内存
+            thread_local std::u16string content;
+            content.assign(lines[i]);
+            result[i] = Parser::validate(content, &cpack);
+        });
+        return result;
+    }
+
+}// namespace CHelper::Batch
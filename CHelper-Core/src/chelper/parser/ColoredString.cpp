@@ -45,7 +45,7 @@ namespace CHelper {
                   color);
     }
     void ColoredString::setColor(const TokensView &tokensView, uint32_t color) {
-        setColor(tokensView.startIndex, tokensView.endIndex, color);
+        setColor(tokensView.getStartIndex(), tokensView.getEndIndex(), color);
     }
 
 }// namespace CHelper
@@ -0,0 +1,178 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/node/NodeType.h>
+#include <chelper/parser/CommandGenerator.h>
+#include <chelper/parser/Parser.h>
+
+namespace CHelper {
+
+    //每条命令最多尝试生成的次数
+    static constexpr size_t MAX_ATTEMPTS = 64;
+
+    CommandGenerator::CommandGenerator(uint32_t seed)
+        : random(seed) {}
+
+    std::optional<std::u16string> CommandGenerator::generate(const CPack &cpack) {
+        result.clear();
+        depth = 0;
+        isFailed = false;
+        cpack.mainNode->generate(*this);
+        if (HEDLEY_UNLIKELY(isFailed || result.empty())) {
+            return std::nullopt;
+        }
+        return std::move(result);
+    }
+
+    bool CommandGenerator::push() {
+        if (HEDLEY_UNLIKELY(isFailed || depth >= HARD_MAX_DEPTH || result.length() >= MAX_LENGTH)) {
+            isFailed = true;
+            return false;
+        }
+        depth++;
+        return true;
+    }
+
+    void CommandGenerator::pop() {
+        depth--;
+    }
+
+    void CommandGenerator::fail() {
+        isFailed = true;
+    }
+
+    bool CommandGenerator::isTooDeep() const {
+        return depth >= SOFT_MAX_DEPTH;
+    }
+
+    size_t CommandGenerator::nextIndex(size_t size) {
+        return HEDLEY_UNLIKELY(size <= 1) ? 0 : random() % size;
+    }
+
+    bool CommandGenerator::nextBoolean(uint32_t percent) {
+        return random() % 100 < percent;
+    }
+
+    const Node::NodeBase *CommandGenerator::nextNode(const std::vector<Node::NodeBase *> &nextNodes) {
+        if (HEDLEY_UNLIKELY(isTooDeep())) {
+            for (const auto &item: nextNodes) {
+                if (HEDLEY_UNLIKELY(item->getNodeType() == Node::NodeTypeId::LF)) {
+                    return item;
+                }
+            }
+        }
+        return nextElement(nextNodes);
+    }
+
+    void CommandGenerator::append(char16_t ch) {
+        result.push_back(ch);
+    }
+
+    void CommandGenerator::append(const std::u16string_view &str) {
+        result.append(str);
+    }
+
+    void CommandGenerator::appendInteger(int64_t min, int64_t max) {
+        if (HEDLEY_UNLIKELY(min > max)) {
+            fail();
+            return;
+        }
+        auto value = min + static_cast<int64_t>(random() % static_cast<uint64_t>(max - min + 1));
+        append(utf8::utf8to16(std::to_string(value)));
+    }
+
+    void CommandGenerator::appendFloat(double min, double max) {
+        auto integerMin = static_cast<int64_t>(std::ceil(min));
+        auto integerMax = static_cast<int64_t>(std::floor(max));
+        if (HEDLEY_UNLIKELY(integerMin > integerMax)) {
+            // 范围内没有整数
+            append(utf8::utf8to16(std::to_string(min)));
+            return;
+        }
+        auto value = integerMin + static_cast<int64_t>(random() % static_cast<uint64_t>(integerMax - integerMin + 1));
+        append(utf8::utf8to16(std::to_string(value)));
+        if (HEDLEY_LIKELY(value < integerMax && value >= 0 && nextBoolean(30))) {
+            append(u'.');
+            append(static_cast<char16_t>(u'1' + nextIndex(9)));
+        }
+    }
+
+    void CommandGenerator::appendWord() {
+        size_t length = 1 + nextIndex(8);
+        for (size_t i = 0; i < length; ++i) {
+            append(static_cast<char16_t>(u'a' + nextIndex(26)));
+        }
+    }
+
+    //可能出现在命令中的字符，用于生成有一个字符错误的命令，不包含-，因为测试文件中以-开头的行会被忽略
+    static constexpr std::u16string_view mutationChars = u"abcdefghijklmnopqrstuvwxyz0123456789 ~^@[]{}=,.:\"!";
+
+    static std::u16string mutate(CommandGenerator &generator, const std::u16string &command) {
+        std::u16string result = command;
+        switch (generator.nextIndex(5)) {
+            case 0:
+                // 截断，至少保留一个字符
+                result.resize(1 + generator.nextIndex(command.length() - 1));
+                break;
+            case 1:
+                // 删除一个字符
+                result.erase(generator.nextIndex(command.length()), 1);
+                break;
+            case 2:
+                // 插入一个字符
+                result.insert(result.begin() + static_cast<std::ptrdiff_t>(generator.nextIndex(command.length() + 1)),
+                              mutationChars[generator.nextIndex(mutationChars.length())]);
+                break;
+            case 3:
+                // 替换一个字符
+                result[generator.nextIndex(command.length())] = mutationChars[generator.nextIndex(mutationChars.length())];
+                break;
+            default:
+                // 交换相邻的两个字符
+                if (HEDLEY_LIKELY(command.length() >= 2)) {
+                    size_t index = generator.nextIndex(command.length() - 1);
+                    std::swap(result[index], result[index + 1]);
+                }
+                break;
+        }
+        return result;
+    }
+
+    GeneratedCommands generateCommands(const CPack &cpack, size_t validCount, size_t nearValidCount, uint32_t seed) {
+        Profile::push("generating commands");
+        CommandGenerator generator(seed);
+        GeneratedCommands result;
+        result.valid.reserve(validCount);
+        result.nearValid.reserve(nearValidCount);
+        auto nextValid = [&generator, &cpack]() -> std::optional<std::u16string> {
+            for (size_t i = 0; i < MAX_ATTEMPTS; ++i) {
+                std::optional<std::u16string> command = generator.generate(cpack);
+                if (HEDLEY_LIKELY(command.has_value() && Parser::validate(command.value(), &cpack).empty())) {
+                    return command;
+                }
+            }
+            return std::nullopt;
+        };
+        while (result.valid.size() < validCount) {
+            std::optional<std::u16string> command = nextValid();
+            if (HEDLEY_UNLIKELY(!command.has_value())) {
+                break;
+            }
+            result.valid.push_back(std::move(command.value()));
+        }
+        while (result.nearValid.size() < nearValidCount) {
+            std::optional<std::u16string> command = nextValid();
+            if (HEDLEY_UNLIKELY(!command.has_value())) {
+                break;
+            }
+            std::u16string mutation = mutate(generator, command.value());
+            if (HEDLEY_LIKELY(mutation != command.value())) {
+                result.nearValid.push_back(std::move(mutation));
+            }
+        }
+        Profile::pop();
+        return result;
+    }
+
+}// namespace CHelper
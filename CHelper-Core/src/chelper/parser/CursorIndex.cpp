@@ -0,0 +1,99 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/node/NodeBase.h>
+#include <chelper/parser/CursorIndex.h>
+
+namespace CHelper {
+
+    CursorIndex::CursorIndex(const ASTNode &astNode) {
+        std::vector<std::pair<size_t, size_t>> ranges;
+        build(astNode, 0, std::numeric_limits<size_t>::max(), true, ranges);
+        bounds.reserve(ranges.size() * 2);
+        for (const auto &item: ranges) {
+            bounds.push_back(item.first);
+            bounds.push_back(item.second);
+        }
+        std::sort(bounds.begin(), bounds.end());
+        bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+        segments.resize(bounds.size() * 2 + 1);
+        for (size_t i = 0; i < ranges.size(); ++i) {
+            size_t segmentEnd = getSegmentIndex(ranges[i].second);
+            for (size_t j = getSegmentIndex(ranges[i].first); j <= segmentEnd; ++j) {
+                segments[j].push_back(static_cast<uint32_t>(i));
+            }
+        }
+    }
+
+    void CursorIndex::build(const ASTNode &astNode, size_t start, size_t end, bool isBest,
+                            std::vector<std::pair<size_t, size_t>> &ranges) {
+        start = std::max(start, astNode.tokens.getStartIndex());
+        end = std::min(end, astNode.tokens.getEndIndex());
+        if (HEDLEY_UNLIKELY(start > end)) {
+            // 光标不可能同时在这个节点和它所有父节点的范围内，这个节点和它的子节点都不会被访问
+            return;
+        }
+        size_t entryIndex = entries.size();
+        entries.push_back({&astNode, 0, isBest});
+        ranges.emplace_back(start, end);
+        for (size_t i = 0; i < astNode.childNodes.size(); ++i) {
+            bool isChildBest = isBest && (astNode.mode != ASTNodeMode::OR || i == astNode.whichBest);
+            build(astNode.childNodes[i], start, end, isChildBest, ranges);
+        }
+        entries[entryIndex].subtreeEnd = static_cast<uint32_t>(entries.size());
+    }
+
+    size_t CursorIndex::getSegmentIndex(size_t index) const {
+        auto it = std::lower_bound(bounds.begin(), bounds.end(), index);
+        size_t result = static_cast<size_t>(it - bounds.begin()) * 2;
+        if (HEDLEY_LIKELY(it != bounds.end() && *it == index)) {
+            result++;
+        }
+        return result;
+    }
+
+    std::optional<std::u16string> CursorIndex::collectDescription(size_t index) const {
+        for (uint32_t entryIndex: segments[getSegmentIndex(index)]) {
+            const Entry &entry = entries[entryIndex];
+            const ASTNode *astNode = entry.astNode;
+            if (HEDLEY_UNLIKELY(!entry.isBest || astNode->id == ASTNodeId::COMPOUND ||
+                                astNode->id == ASTNodeId::NEXT_NODE || astNode->isAllWhitespaceError())) {
+                continue;
+            }
+            auto description = astNode->node->collectDescription(astNode, index);
+            if (HEDLEY_UNLIKELY(description.has_value())) {
+                return std::move(description);
+            }
+        }
+        return std::nullopt;
+    }
+
+    void CursorIndex::collectSuggestions(size_t index, std::vector<Suggestions> &suggestions) const {
+        // 节点已经添加了补全提示并要求跳过子节点时，跳过先序遍历中在这个位置之前的节点
+        uint32_t skipUntil = 0;
+        for (uint32_t entryIndex: segments[getSegmentIndex(index)]) {
+            const Entry &entry = entries[entryIndex];
+            const ASTNode *astNode = entry.astNode;
+            if (HEDLEY_UNLIKELY(entryIndex < skipUntil || astNode->id == ASTNodeId::COMPOUND ||
+                                astNode->id == ASTNodeId::NEXT_NODE || astNode->isAllWhitespaceError())) {
+                continue;
+            }
+#ifdef CHelperTest
+            Profile::push("collect suggestions: " + NodeTypeHelper::getName(astNode->node->getNodeType()) + " " + astNode->node->description.value_or(""));
+#endif
+            auto flag = astNode->node->collectSuggestions(astNode, index, suggestions);
+#ifdef CHelperTest
+            Profile::pop();
+#endif
+            if (HEDLEY_UNLIKELY(flag)) {
+                skipUntil = entry.subtreeEnd;
+            }
+        }
+    }
+
+    size_t CursorIndex::getEntryCount() const {
+        return entries.size();
+    }
+
+}// namespace CHelper
@@ -0,0 +1,124 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/parser/ParseCache.h>
+
+namespace CHelper {
+
+    const std::shared_ptr<LexerResult> &ParseCache::getLastLexerResult() const {
+        return lastLexerResult;
+    }
+
+    /**
+     * 开始一次新的解析，找出第一个被修改的token
+     */
+    void ParseCache::begin(const std::shared_ptr<LexerResult> &lexerResult0) {
+        lexerResult = lexerResult0;
+        items.clear();
+        firstChangedToken = 0;
+        if (HEDLEY_UNLIKELY(lastLexerResult == nullptr)) {
+            return;
+        }
+        // token中的content可能指向已经被修改的字符串，所以通过LexerResult中的content进行比较
+        std::u16string_view oldContent = lastLexerResult->content;
+        std::u16string_view newContent = lexerResult->content;
+        const std::vector<Token> &oldTokens = lastLexerResult->allTokens;
+        const std::vector<Token> &newTokens = lexerResult->allTokens;
+        size_t size = std::min(oldTokens.size(), newTokens.size());
+        while (firstChangedToken < size) {
+            const Token &oldToken = oldTokens[firstChangedToken];
+            const Token &newToken = newTokens[firstChangedToken];
+            size_t start = oldToken.getStartIndex();
+            size_t length = oldToken.getEndIndex() - start;
+            if (HEDLEY_UNLIKELY(oldToken.type != newToken.type ||
+                                start != newToken.getStartIndex() ||
+                                length != newToken.getEndIndex() - newToken.getStartIndex() ||
+                                oldContent.substr(start, length) != newContent.substr(start, length))) {
+                break;
+            }
+            firstChangedToken++;
+        }
+    }
+
+    /**
+     * 查找上一次解析中可以复用的结果
+     */
+    const ParseCache::Item *ParseCache::find(const Node::NodeBase *node, size_t start) const {
+        if (HEDLEY_LIKELY(start >= firstChangedToken)) {
+            return nullptr;
+        }
+        auto it = lastItems.find({node, start});
+        if (HEDLEY_LIKELY(it == lastItems.end() || it->second.maxIndex >= firstChangedToken)) {
+            return nullptr;
+        }
+        return &it->second;
+    }
+
+    void ParseCache::record(const Node::NodeBase *node, size_t start, size_t end, size_t maxIndex) {
+        items.push_back({node, start, end, maxIndex});
+    }
+
+    static void rebind(ASTNode &astNode,
+                       const LexerResult *from,
+                       const LexerResult *to) {
+        // 不是这一层词法分析结果的节点（例如JSON字符串内部的节点）保持不变
+        if (HEDLEY_UNLIKELY(astNode.tokens.lexerResult != from)) {
+            return;
+        }
+        astNode.tokens.lexerResult = to;
+        for (auto &item: astNode.childNodes) {
+            rebind(item, from, to);
+        }
+    }
+
+    /**
+     * 复制上一次解析的结果，并让它指向本次解析的词法分析结果
+     */
+    ASTNode ParseCache::copy(const Item &item) const {
+        ASTNode result = *item.astNode;
+        rebind(result, lastLexerResult.get(), lexerResult.get());
+        return result;
+    }
+
+    static void collectCompoundNodes(const ASTNode &astNode,
+                                     std::unordered_map<ParseCache::Key, const ASTNode *, ParseCache::KeyHash> &result) {
+        if (HEDLEY_UNLIKELY(astNode.id == ASTNodeId::COMPOUND && astNode.mode == ASTNodeMode::AND && astNode.hasChildNode())) {
+            result.emplace(ParseCache::Key(astNode.node, astNode.tokens.start), &astNode.childNodes[0]);
+        }
+        for (const auto &item: astNode.childNodes) {
+            collectCompoundNodes(item, result);
+        }
+    }
+
+    /**
+     * 解析结束后调用，从AST中找到本次解析记录的结果对应的节点，作为下一次解析可以复用的结果
+     *
+     * @param astNode 本次解析得到的AST，在下一次解析结束前不能被修改或者销毁
+     */
+    void ParseCache::attach(const ASTNode &astNode) {
+        std::unordered_map<Key, const ASTNode *, KeyHash> compoundNodes;
+        collectCompoundNodes(astNode, compoundNodes);
+        lastItems.clear();
+        for (auto &item: items) {
+            auto it = compoundNodes.find({item.node, item.start});
+            if (HEDLEY_UNLIKELY(it == compoundNodes.end())) {
+                continue;
+            }
+            item.astNode = it->second;
+            lastItems.emplace(Key(item.node, item.start), item);
+        }
+        items.clear();
+        lastLexerResult = std::move(lexerResult);
+        lexerResult = nullptr;
+    }
+
+    void ParseCache::clear() {
+        lastLexerResult = nullptr;
+        lastItems.clear();
+        items.clear();
+        lexerResult = nullptr;
+        firstChangedToken = 0;
+    }
+
+}// namespace CHelper
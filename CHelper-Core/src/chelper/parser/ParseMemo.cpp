@@ -0,0 +1,31 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/parser/ParseMemo.h>
+
+namespace CHelper {
+
+    ParseMemo::ParseMemo(bool isEnableCache)
+        : isEnableCache(isEnableCache) {}
+
+    const ParseMemo::Item *ParseMemo::find(const Node::NodeBase *node, size_t start, bool isRequireWhitespace) {
+        if (HEDLEY_LIKELY(isEnableCache)) {
+            auto it = items.find({node, start, isRequireWhitespace});
+            if (HEDLEY_UNLIKELY(it != items.end())) {
+                hitCount++;
+                return &it->second;
+            }
+        }
+        visitCount++;
+        return nullptr;
+    }
+
+    void ParseMemo::save(const Node::NodeBase *node, size_t start, bool isRequireWhitespace,
+                         size_t end, size_t maxIndex, const ASTNode &astNode) {
+        if (HEDLEY_LIKELY(isEnableCache)) {
+            items.emplace(Key{node, start, isRequireWhitespace}, Item{end, maxIndex, astNode});
+        }
+    }
+
+}// namespace CHelper
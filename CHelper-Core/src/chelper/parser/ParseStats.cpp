@@ -0,0 +1,30 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/parser/ParseStats.h>
+
+namespace CHelper {
+
+    void ParseStats::clear() {
+        getASTNodeCounts.fill(0);
+        backtrackTokens = 0;
+    }
+
+    ParseStats &ParseStats::operator+=(const ParseStats &parseStats) {
+        for (size_t i = 0; i < getASTNodeCounts.size(); ++i) {
+            getASTNodeCounts[i] += parseStats.getASTNodeCounts[i];
+        }
+        backtrackTokens += parseStats.backtrackTokens;
+        return *this;
+    }
+
+    size_t ParseStats::getASTNodeCount() const {
+        size_t result = 0;
+        for (const auto &item: getASTNodeCounts) {
+            result += item;
+        }
+        return result;
+    }
+
+}// namespace CHelper
@@ -3,26 +3,66 @@
 //
 
 #include <chelper/node/NodeType.h>
+#include <chelper/parser/ParseCache.h>
+#include <chelper/parser/ParseMemo.h>
+#include <chelper/parser/ParseStats.h>
 #include <chelper/parser/Parser.h>
 
 namespace CHelper::Parser {
 
-    ASTNode parse(const std::u16string &content, const CPack *cpack, const Node::NodeBase *mainNode) {
-        TokenReader tokenReader = TokenReader(std::make_shared<LexerResult>(Lexer::lex(content)));
+    static ASTNode parse(TokenReader &tokenReader, const CPack *cpack, const Node::NodeBase *mainNode) {
 #ifdef CHelperTest 
         Profile::push("start parsing: {}", tokenReader.lexerResult->content);
 #endif
+        CHELPER_TRACE_SCOPE("Parser::parse");
         DEBUG_GET_NODE_BEGIN(mainNode)
-        auto result = mainNode->getASTNode(tokenReader, cpack);
+        auto result = Node::NodeBase::dispatchASTNode(mainNode, tokenReader, cpack);
         DEBUG_GET_NODE_END(mainNode)
 #ifdef CHelperTest 
         Profile::pop();
 #endif
+        result.lexerResult = tokenReader.lexerResult;
         return result;
     }
 
+    ASTNode parse(const std::u16string &content, const CPack *cpack, const Node::NodeBase *mainNode) {
+        TokenReader tokenReader = TokenReader(std::make_shared<LexerResult>(Lexer::lex(content)));
+        return parse(tokenReader, cpack, mainNode);
+    }
+
     ASTNode parse(const std::u16string &content, const CPack *cpack) {
         return parse(content, cpack, cpack->mainNode.get());
     }
 
+    ASTNode parse(const std::u16string &content, const CPack *cpack, ParseMemo &parseMemo) {
+        TokenReader tokenReader = TokenReader(std::make_shared<LexerResult>(Lexer::lex(content)));
+        tokenReader.parseMemo = &parseMemo;
+        return parse(tokenReader, cpack, cpack->mainNode.get());
+    }
+
+    ASTNode parse(const std::u16string &content, const CPack *cpack, ParseStats &parseStats) {
+        TokenReader tokenReader = TokenReader(std::make_shared<LexerResult>(Lexer::lex(content)));
+        tokenReader.parseStats = &parseStats;
+        return parse(tokenReader, cpack, cpack->mainNode.get());
+    }
+
+    std::vector<std::shared_ptr<ErrorReason>> validate(const std::u16string &content, const CPack *cpack) {
+        TokenReader tokenReader = TokenReader(std::make_shared<LexerResult>(Lexer::lex(content)));
+        tokenReader.isOnlyErrorReasons = true;
+        return parse(tokenReader, cpack, cpack->mainNode.get()).getErrorReasons();
+    }
+
+    ASTNode parse(const std::u16string &content, const CPack *cpack, ParseCache &parseCache,
+                  ParseMemo *parseMemo, ParseStats *parseStats) {
+        const std::shared_ptr<LexerResult> &lastLexerResult = parseCache.getLastLexerResult();
+        std::shared_ptr<LexerResult> lexerResult = std::make_shared<LexerResult>(
+                lastLexerResult == nullptr ? Lexer::lex(content) : Lexer::relex(*lastLexerResult, content));
+        parseCache.begin(lexerResult);
+        TokenReader tokenReader = TokenReader(lexerResult);
+        tokenReader.parseCache = &parseCache;
+        tokenReader.parseMemo = parseMemo;
+        tokenReader.parseStats = parseStats;
+        return parse(tokenReader, cpack, cpack->mainNode.get());
+    }
+
 }// namespace CHelper::Parser
\ No newline at end of file
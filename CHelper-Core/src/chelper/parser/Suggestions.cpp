@@ -17,23 +17,30 @@ namespace CHelper {
         : suggestionsType(suggestionsType) {}
 
     bool Suggestions::isFiltered() {
-        return mHashCode.has_value();
+        return mIsFiltered;
     }
 
     size_t Suggestions::hashCode() {
-        return mHashCode.value_or(0);
-    }
-
-    void Suggestions::markFiltered() {
-        if (HEDLEY_UNLIKELY(isFiltered())) {
-            return;
+        if (HEDLEY_LIKELY(mHashCode.has_value())) {
+            return mHashCode.value();
         }
-        //生成哈希值
+        //生成哈希值，延迟生成的补全提示和Suggestion使用相同的计算方式，不需要创建Suggestion
         size_t hashCode = 0;
-        for (const auto &item: suggestions) {
-            hashCode = 31 * hashCode + item.hashCode();
+        if (HEDLEY_UNLIKELY(getLazyContent != nullptr)) {
+            for (size_t i = 0; i < lazySize; ++i) {
+                hashCode = 31 * hashCode + 31 * 31 * getLazyContent(i)->hashCode() + 31 * lazyStart + lazyEnd;
+            }
+        } else {
+            for (const auto &item: suggestions) {
+                hashCode = 31 * hashCode + item.hashCode();
+            }
         }
         mHashCode = hashCode;
+        return hashCode;
+    }
+
+    void Suggestions::markFiltered() {
+        mIsFiltered = true;
     }
 
     void Suggestions::filter() {
@@ -55,10 +62,20 @@ namespace CHelper {
             }
         }
         suggestions = std::move(filteredSuggestions);
-        //生成哈希值
         markFiltered();
     }
 
+    size_t Suggestions::size() const {
+        return getLazyContent == nullptr ? suggestions.size() : lazySize;
+    }
+
+    Suggestion Suggestions::at(size_t which) const {
+        if (HEDLEY_LIKELY(getLazyContent == nullptr)) {
+            return suggestions.at(which);
+        }
+        return {lazyStart, lazyEnd, lazyIsAddWhitespace, getLazyContent(which)};
+    }
+
     Suggestions Suggestions::singleSuggestion(SuggestionsType::SuggestionsType suggestionsType, Suggestion suggestion) {
         Suggestions suggestions(suggestionsType);
         suggestions.suggestions.push_back(std::move(suggestion));
@@ -78,34 +95,82 @@ namespace CHelper {
         return singleSuggestion(SuggestionsType::LITERAL, std::move(suggestion));
     }
 
+    Suggestions Suggestions::lazyIdSuggestions(size_t start, size_t end, bool isAddWhitespace, size_t size,
+                                               std::function<std::shared_ptr<NormalId>(size_t)> getContent) {
+        Suggestions suggestions(SuggestionsType::ID);
+        suggestions.lazyStart = start;
+        suggestions.lazyEnd = end;
+        suggestions.lazySize = size;
+        suggestions.lazyIsAddWhitespace = isAddWhitespace;
+        suggestions.getLazyContent = std::move(getContent);
+        suggestions.markFiltered();
+        return suggestions;
+    }
+
     std::vector<Suggestion> Suggestions::filter(std::vector<Suggestions> &suggestions) {
-        // 过滤
+        return SuggestionList(std::move(suggestions)).getAll();
+    }
+
+    SuggestionList::SuggestionList(std::vector<Suggestions> suggestions) {
+        // 过滤，数量不同的两组补全提示一定不同，只有数量相同时才需要计算哈希值
         std::vector<Suggestions> filteredSuggestions;
         for (auto &item: suggestions) {
             item.filter();
             if (HEDLEY_LIKELY(std::all_of(
                         filteredSuggestions.begin(), filteredSuggestions.end(),
                         [&item](Suggestions &item2) {
-                            return item.hashCode() != item2.hashCode();
+                            return item.size() != item2.size() || item.hashCode() != item2.hashCode();
                         }))) {
-                filteredSuggestions.push_back(item);
+                filteredSuggestions.push_back(std::move(item));
             }
         }
         // 根据优先级进行排序
-        std::vector<Suggestion> result;
-        size_t sum = 0;
-        for (const auto &item: filteredSuggestions) {
-            sum += item.suggestions.size();
-        }
-        result.reserve(sum);
+        groups.reserve(filteredSuggestions.size());
+        groupStarts.reserve(filteredSuggestions.size());
         for (int suggestionsType = 0; suggestionsType <= SuggestionsType::suggestionsTypeMax; ++suggestionsType) {
-            for (const auto &item: filteredSuggestions) {
-                if (item.suggestionsType == suggestionsType) {
-                    std::copy(item.suggestions.begin(), item.suggestions.end(), std::back_inserter(result));
+            for (auto &item: filteredSuggestions) {
+                if (item.suggestionsType == suggestionsType && item.size() != 0) {
+                    groupStarts.push_back(count);
+                    count += item.size();
+                    groups.push_back(std::move(item));
                 }
             }
         }
+    }
+
+    size_t SuggestionList::size() const {
+        return count;
+    }
+
+    Suggestion SuggestionList::at(size_t which) const {
+        if (HEDLEY_UNLIKELY(which >= count)) {
+            throw std::out_of_range("suggestion index out of range");
+        }
+        size_t groupIndex = static_cast<size_t>(std::upper_bound(groupStarts.begin(), groupStarts.end(), which) - groupStarts.begin()) - 1;
+        return groups[groupIndex].at(which - groupStarts[groupIndex]);
+    }
+
+    std::vector<Suggestion> SuggestionList::get(size_t offset, size_t limit) const {
+        std::vector<Suggestion> result;
+        if (HEDLEY_UNLIKELY(offset >= count)) {
+            return result;
+        }
+        size_t end = offset + std::min(limit, count - offset);
+        result.reserve(end - offset);
+        // 找到offset所在的组，然后按顺序创建补全提示，直到得到足够的数量
+        size_t groupIndex = static_cast<size_t>(std::upper_bound(groupStarts.begin(), groupStarts.end(), offset) - groupStarts.begin()) - 1;
+        for (size_t i = offset; i < end; ++groupIndex) {
+            const Suggestions &group = groups[groupIndex];
+            size_t groupEnd = std::min(end, groupStarts[groupIndex] + group.size());
+            for (; i < groupEnd; ++i) {
+                result.push_back(group.at(i - groupStarts[groupIndex]));
+            }
+        }
         return result;
     }
 
+    std::vector<Suggestion> SuggestionList::getAll() const {
+        return get(0, count);
+    }
+
 }// namespace CHelper
\ No newline at end of file
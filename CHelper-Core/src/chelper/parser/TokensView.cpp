@@ -6,13 +6,10 @@
 
 namespace CHelper {
 
-    TokensView::TokensView(const std::shared_ptr<LexerResult> &lexerResult, size_t start, size_t end)
+    TokensView::TokensView(const LexerResult *lexerResult, size_t start, size_t end)
         : lexerResult(lexerResult),
           start(start),
           end(end) {
-        startIndex = getIndex(start);
-        endIndex = getIndex(end);
-        cacheString = {lexerResult->content.c_str() + startIndex, endIndex - startIndex};
 #ifdef CHelperDebug
         if (HEDLEY_UNLIKELY(start > end)) {
             throw std::runtime_error("TokensView: wrong range: (" + std::to_string(start) + ", " + std::to_string(end) + ")");
@@ -61,15 +58,16 @@ namespace CHelper {
     }
 
     [[nodiscard]] size_t TokensView::getStartIndex() const {
-        return startIndex;
+        return getIndex(start);
     }
 
     [[nodiscard]] size_t TokensView::getEndIndex() const {
-        return endIndex;
+        return getIndex(end);
     }
 
     [[nodiscard]] std::u16string_view TokensView::toString() const {
-        return cacheString;
+        size_t startIndex = getStartIndex();
+        return std::u16string_view(lexerResult->content).substr(startIndex, getEndIndex() - startIndex);
     }
 
 }// namespace CHelper
\ No newline at end of file
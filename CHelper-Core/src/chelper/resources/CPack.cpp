@@ -5,44 +5,184 @@
 #include <chelper/node/NodeType.h>
 #include <chelper/resources/CPack.h>
 #include <chelper/resources/Manifest.h>
+#include <chelper/resources/id/IdStringTable.h>
+#include <chelper/util/Parallel.h>
 
 namespace CHelper {
 
+    static std::unique_ptr<Node::NodeJsonElement> decodeJsonNode(const rapidjson::GenericValue<rapidjson::UTF8<>> &j) {
+        using JsonValueType = rapidjson::GenericValue<rapidjson::UTF8<>>;
+        std::unique_ptr<Node::NodeJsonElement> item;
+        serialization::Codec<decltype(item)>::template from_json<JsonValueType>(j, item);
+        return item;
+    }
+
+    static RepeatData decodeRepeatData(const rapidjson::GenericValue<rapidjson::UTF8<>> &j) {
+        using JsonValueType = rapidjson::GenericValue<rapidjson::UTF8<>>;
+        RepeatData item;
+        serialization::Codec<decltype(item)>::template from_json<JsonValueType>(j, item);
+        return item;
+    }
+
+    static std::unique_ptr<Node::NodePerCommand> decodeCommand(const rapidjson::GenericValue<rapidjson::UTF8<>> &j) {
+        using JsonValueType = rapidjson::GenericValue<rapidjson::UTF8<>>;
+        std::unique_ptr<Node::NodePerCommand> item;
+        serialization::Codec<decltype(item)>::template from_json<JsonValueType>(j, item);
+        return item;
+    }
+
+    /**
+     * 二进制资源包中可以延迟读取的部分，二进制资源包总是使用isNeedConvert=true读写
+     */
+    static void readIdData(std::istream &istream, CPack &cpack) {
+        IdStringTable::fromBinary(istream, cpack.normalIds, cpack.namespaceIds);
+    }
+
+    static void readItemIds(std::istream &istream, CPack &cpack) {
+        serialization::template from_binary<true>(istream, cpack.itemIds);
+    }
+
+    static void readBlockIds(std::istream &istream, CPack &cpack) {
+        serialization::template from_binary<true>(istream, cpack.blockIds);
+    }
+
+    static void readIdSets(std::istream &istream, CPack &cpack) {
+        serialization::template from_binary<true>(istream, cpack.normalIdSets);
+        serialization::template from_binary<true>(istream, cpack.namespaceIdSets);
+    }
+
+    static void readJsonNodes(std::istream &istream, CPack &cpack) {
+        // 节点创建阶段是每个线程独立的，延迟读取时可能在其他线程中
+        Node::currentCreateStage = Node::NodeCreateStage::JSON_NODE;
+        serialization::template from_binary<true>(istream, cpack.jsonNodes);
+        Node::currentCreateStage = Node::NodeCreateStage::NONE;
+    }
+
+    static void readRepeatData(std::istream &istream, CPack &cpack) {
+        Node::currentCreateStage = Node::NodeCreateStage::REPEAT_NODE;
+        serialization::template from_binary<true>(istream, cpack.repeatNodeData);
+        Node::currentCreateStage = Node::NodeCreateStage::NONE;
+    }
+
 #ifndef CHELPER_NO_FILESYSTEM
+    /**
+     * 资源包文件夹中的一个json文件
+     *
+     * 读取和解析文件互不影响，可以在多个线程中同时进行，结果保存在这里，之后再按照文件的顺序加入资源包
+     */
+    class CPackFile {
+    public:
+        std::filesystem::path path;
+        Node::NodeCreateStage::NodeCreateStage stage;
+        // id文件会修改资源包中共用的id表，只读取json，在合并时再按顺序加入资源包
+        std::unique_ptr<rapidjson::GenericDocument<rapidjson::UTF8<>>> idJson;
+        std::unique_ptr<Node::NodeJsonElement> jsonNode;
+        std::optional<RepeatData> repeatData;
+        std::unique_ptr<Node::NodePerCommand> command;
+
+        CPackFile(std::filesystem::path path, Node::NodeCreateStage::NodeCreateStage stage)
+            : path(std::move(path)),
+              stage(stage) {}
+
+        /**
+         * 只有出现异常时才会把文件路径加入Profile的栈中，正常读取时不需要格式化字符串
+         */
+        void load() {
+            CHELPER_TRACE_SCOPE_ARGS("CPack::loadFile", "{}", path.u16string());
+            size_t stackSize = Profile::stack.size();
+            try {
+                // 节点创建阶段是每个线程独立的，需要在解析的线程中设置
+                Node::currentCreateStage = stage;
+                auto j = serialization::get_json_from_file(path);
+                switch (stage) {
+                    case Node::NodeCreateStage::JSON_NODE:
+                        jsonNode = decodeJsonNode(j);
+                        break;
+                    case Node::NodeCreateStage::REPEAT_NODE:
+                        repeatData = decodeRepeatData(j);
+                        break;
+                    case Node::NodeCreateStage::COMMAND_PARAM_NODE:
+                        command = decodeCommand(j);
+                        break;
+                    default:
+                        idJson = std::make_unique<rapidjson::GenericDocument<rapidjson::UTF8<>>>(std::move(j));
+                        break;
+                }
+                Node::currentCreateStage = Node::NodeCreateStage::NONE;
+            } catch (...) {
+                Node::currentCreateStage = Node::NodeCreateStage::NONE;
+                Profile::insert(stackSize, R"(in path "{}")", path.u16string());
+                throw;
+            }
+        }
+    };
+
+    /**
+     * 按照文件路径排序，这样每次读取的结果都是相同的，不受文件系统遍历顺序和线程调度的影响
+     */
+    static void collectJsonFiles(std::vector<CPackFile> &files, const std::filesystem::path &path, Node::NodeCreateStage::NodeCreateStage stage) {
+        std::vector<std::filesystem::path> paths;
+        for (const auto &file: std::filesystem::recursive_directory_iterator(path)) {
+            if (HEDLEY_LIKELY(file.is_regular_file())) {
+                paths.push_back(file.path());
+            }
+        }
+        std::sort(paths.begin(), paths.end());
+        for (auto &item: paths) {
+            files.emplace_back(std::move(item), stage);
+        }
+    }
+
     CPack::CPack(const std::filesystem::path &path) {
 #ifdef CHelperDebug
         size_t stackSize = Profile::stack.size();
 #endif
         Node::currentCreateStage = Node::NodeCreateStage::NONE;
+        CHELPER_TRACE_SCOPE("CPack::loadManifest");
         Profile::push("loading manifest");
         auto jsonManifest = serialization::get_json_from_file(path / "manifest.json");
         serialization::Codec<Manifest>::template from_json(jsonManifest, manifest);
-        Profile::next("loading id data");
-        for (const auto &file: std::filesystem::recursive_directory_iterator(path / "id")) {
-            Profile::next(R"(loading id data in path "{}")", file.path().u16string());
-            applyId(serialization::get_json_from_file(file));
-        }
-        Profile::next("loading json data");
-        Node::currentCreateStage = Node::NodeCreateStage::JSON_NODE;
-        for (const auto &file: std::filesystem::recursive_directory_iterator(path / "json")) {
-            Profile::next(R"(loading json data in path "{}")", file.path().u16string());
-            applyJson(serialization::get_json_from_file(file));
-        }
-        Profile::next("loading repeat data");
-        Node::currentCreateStage = Node::NodeCreateStage::REPEAT_NODE;
-        for (const auto &file: std::filesystem::recursive_directory_iterator(path / "repeat")) {
-            Profile::next(R"(loading repeat data in path "{}")", file.path().u16string());
-            applyRepeat(serialization::get_json_from_file(file));
-        }
-        Profile::next("loading commands");
-        Node::currentCreateStage = Node::NodeCreateStage::COMMAND_PARAM_NODE;
-        for (const auto &file: std::filesystem::recursive_directory_iterator(path / "command")) {
-            Profile::next(R"(loading command in path "{}")", file.path().u16string());
-            applyCommand(serialization::get_json_from_file(file));
+        // 读取文件和解析json占了大部分时间，每个文件互不影响，在多个线程中同时进行
+        CHELPER_TRACE_NEXT("CPack::loadFiles");
+        Profile::next("loading files");
+        std::vector<CPackFile> files;
+        collectJsonFiles(files, path / "id", Node::NodeCreateStage::NONE);
+        collectJsonFiles(files, path / "json", Node::NodeCreateStage::JSON_NODE);
+        collectJsonFiles(files, path / "repeat", Node::NodeCreateStage::REPEAT_NODE);
+        collectJsonFiles(files, path / "command", Node::NodeCreateStage::COMMAND_PARAM_NODE);
+        Parallel::forEach(files.size(), 0, 1, [&files](size_t i) {
+            files[i].load();
+        });
+        // 按照id、json、repeat、command的顺序合并，和单线程读取的结果相同
+        CHELPER_TRACE_NEXT("CPack::mergeFiles");
+        Profile::next("merging files");
+        for (auto &file: files) {
+            switch (file.stage) {
+                case Node::NodeCreateStage::JSON_NODE:
+                    jsonNodes.push_back(std::move(file.jsonNode));
+                    break;
+                case Node::NodeCreateStage::REPEAT_NODE:
+                    repeatNodeData.push_back(std::move(file.repeatData.value()));
+                    break;
+                case Node::NodeCreateStage::COMMAND_PARAM_NODE:
+                    commands->push_back(std::move(file.command));
+                    break;
+                default: {
+                    size_t stackSize0 = Profile::stack.size();
+                    try {
+                        applyId(*file.idJson);
+                    } catch (...) {
+                        Profile::insert(stackSize0, R"(in path "{}")", file.path.u16string());
+                        throw;
+                    }
+                    break;
+                }
+            }
         }
+        files.clear();
+        CHELPER_TRACE_NEXT("CPack::afterApply");
         Profile::next("init cpack");
-        Node::currentCreateStage = Node::NodeCreateStage::NONE;
-        afterApply();
+        afterApply(0);
         Profile::pop();
 #ifdef CHelperDebug
         if (HEDLEY_UNLIKELY(Profile::stack.size() != stackSize)) {
@@ -58,30 +198,36 @@ namespace CHelper {
         size_t stackSize = Profile::stack.size();
 #endif
         Node::currentCreateStage = Node::NodeCreateStage::NONE;
+        CHELPER_TRACE_SCOPE("CPack::loadManifest");
         Profile::push("loading manifest");
         serialization::Codec<Manifest>::template from_json_member<JsonValueType>(j, "manifest", manifest);
+        CHELPER_TRACE_NEXT("CPack::loadIdData");
         Profile::next("loading id data");
         for (const auto &item: serialization::find_array_member_or_throw(j, "id")) {
             applyId(item);
         }
+        CHELPER_TRACE_NEXT("CPack::loadJsonData");
         Profile::next("loading json data");
         Node::currentCreateStage = Node::NodeCreateStage::JSON_NODE;
         for (const auto &item: serialization::find_array_member_or_throw(j, "json")) {
             applyJson(item);
         }
+        CHELPER_TRACE_NEXT("CPack::loadRepeatData");
         Profile::next("loading repeat data");
         Node::currentCreateStage = Node::NodeCreateStage::REPEAT_NODE;
         for (const auto &item: serialization::find_array_member_or_throw(j, "repeat")) {
             applyRepeat(item);
         }
+        CHELPER_TRACE_NEXT("CPack::loadCommandData");
         Profile::next("loading command data");
         Node::currentCreateStage = Node::NodeCreateStage::COMMAND_PARAM_NODE;
         for (const auto &item: serialization::find_array_member_or_throw(j, "command")) {
             applyCommand(item);
         }
+        CHELPER_TRACE_NEXT("CPack::afterApply");
         Profile::next("init cpack");
         Node::currentCreateStage = Node::NodeCreateStage::NONE;
-        afterApply();
+        afterApply(1);
         Profile::pop();
 #ifdef CHelperDebug
         if (HEDLEY_UNLIKELY(Profile::stack.size() != stackSize)) {
@@ -95,28 +241,57 @@ namespace CHelper {
         size_t stackSize = Profile::stack.size();
 #endif
         Node::currentCreateStage = Node::NodeCreateStage::NONE;
-        Profile::push("loading manifest");
+        CHELPER_TRACE_SCOPE("CPack::loadManifest");
+        Profile::push("checking binary format");
+        uint32_t magic = 0, formatVersion = 0;
+        serialization::Codec<uint32_t>::template from_binary<true>(istream, magic);
+        if (HEDLEY_UNLIKELY(!istream || magic != BINARY_MAGIC)) {
+            Profile::push("file is not a binary cpack");
+            throw std::runtime_error("file is not a binary cpack");
+        }
+        serialization::Codec<uint32_t>::template from_binary<true>(istream, formatVersion);
+        if (HEDLEY_UNLIKELY(!istream || formatVersion != BINARY_FORMAT_VERSION)) {
+            Profile::push("binary cpack format version mismatch: expect {}, but got {}", BINARY_FORMAT_VERSION, formatVersion);
+            throw std::runtime_error("binary cpack format version mismatch");
+        }
+        Profile::next("loading manifest");
         serialization::template from_binary<true>(istream, manifest);
-        Profile::next("loading normal id data");
-        serialization::template from_binary<true>(istream, normalIds);
-        Profile::next("loading namespace id data");
-        serialization::template from_binary<true>(istream, namespaceIds);
+        // 从有持有者的内存中读取时，ID、ID列表的名字集合、JSON数据和重复部分只记录位置，第一次使用时才读取
+        CHELPER_TRACE_NEXT("CPack::loadIdData");
+        Profile::next("loading normal id and namespace id data");
+        idSection.read(istream, [this](std::istream &stream) {
+            readIdData(stream, *this);
+        });
         Profile::next("loading item id data");
-        serialization::template from_binary<true>(istream, itemIds);
+        itemIdSection.read(istream, [this](std::istream &stream) {
+            readItemIds(stream, *this);
+        });
         Profile::next("loading block id data");
-        serialization::template from_binary<true>(istream, blockIds);
+        blockIdSection.read(istream, [this](std::istream &stream) {
+            readBlockIds(stream, *this);
+        });
+        Profile::next("loading id set data");
+        idSetSection.read(istream, [this](std::istream &stream) {
+            readIdSets(stream, *this);
+        });
+        CHELPER_TRACE_NEXT("CPack::loadJsonData");
         Profile::next("loading json data");
-        Node::currentCreateStage = Node::NodeCreateStage::JSON_NODE;
-        serialization::template from_binary<true>(istream, jsonNodes);
+        jsonSection.read(istream, [this](std::istream &stream) {
+            readJsonNodes(stream, *this);
+        });
+        CHELPER_TRACE_NEXT("CPack::loadRepeatData");
         Profile::next("loading repeat data");
-        Node::currentCreateStage = Node::NodeCreateStage::REPEAT_NODE;
-        serialization::template from_binary<true>(istream, repeatNodeData);
+        repeatSection.read(istream, [this](std::istream &stream) {
+            readRepeatData(stream, *this);
+        });
+        CHELPER_TRACE_NEXT("CPack::loadCommandData");
         Profile::next("loading command data");
         Node::currentCreateStage = Node::NodeCreateStage::COMMAND_PARAM_NODE;
         serialization::template from_binary<true>(istream, commands);
+        CHELPER_TRACE_NEXT("CPack::afterApply");
         Profile::next("init cpack");
         Node::currentCreateStage = Node::NodeCreateStage::NONE;
-        afterApply();
+        afterApply(1);
         Profile::pop();
 #ifdef CHelperDebug
         if (HEDLEY_UNLIKELY(Profile::stack.size() != stackSize)) {
@@ -152,96 +327,330 @@ namespace CHelper {
     }
 
     void CPack::applyJson(const rapidjson::GenericValue<rapidjson::UTF8<>> &j) {
-        using JsonValueType = rapidjson::GenericValue<rapidjson::UTF8<>>;
-        std::unique_ptr<Node::NodeJsonElement> item;
-        serialization::Codec<decltype(item)>::template from_json<JsonValueType>(j, item);
-        jsonNodes.push_back(std::move(item));
+        jsonNodes.push_back(decodeJsonNode(j));
     }
 
     void CPack::applyRepeat(const rapidjson::GenericValue<rapidjson::UTF8<>> &j) {
-        using JsonValueType = rapidjson::GenericValue<rapidjson::UTF8<>>;
-        RepeatData item;
-        serialization::Codec<decltype(item)>::template from_json<JsonValueType>(j, item);
-        repeatNodeData.push_back(std::move(item));
+        repeatNodeData.push_back(decodeRepeatData(j));
     }
 
     void CPack::applyCommand(const rapidjson::GenericValue<rapidjson::UTF8<>> &j) const {
-        using JsonValueType = rapidjson::GenericValue<rapidjson::UTF8<>>;
-        std::unique_ptr<Node::NodePerCommand> item;
-        serialization::Codec<decltype(item)>::template from_json<JsonValueType>(j, item);
-        commands->push_back(std::move(item));
+        commands->push_back(decodeCommand(j));
     }
 
-    void CPack::afterApply() {
-        // json nodes
-        Profile::push("init json nodes");
-        for (const auto &item: jsonNodes) {
-            item->init(*this);
-        }
-        // repeat nodes
-        Profile::next("init repeat nodes");
-        for (const auto &item: repeatNodeData) {
-            if (HEDLEY_UNLIKELY(item.repeatNodes.size() != item.isEnd.size())) {
-                Profile::push("checking repeat node: {}", item.id);
-                throw std::runtime_error("fail to check repeat id because repeatNodes size not equal isEnd size");
+    /**
+     * 只有从目录读取时使用多个线程初始化节点，从JSON和二进制读取的资源包也会在Web等不支持线程的平台上使用，只在当前线程中初始化
+     *
+     * @param threads 初始化节点时使用的线程数量，为0时使用硬件支持的并发线程数量
+     */
+    void CPack::afterApply(size_t threads) {
+        CHELPER_TRACE_SCOPE("CPack::initIdData");
+        Profile::push("init id data");
+        // 从内存中读取的二进制资源包的ID、JSON数据和重复部分在第一次使用时才读取和初始化，二进制资源包中的ID列表的名字集合是完整的
+        if (HEDLEY_LIKELY(!idSection.isDeferred())) {
+            loadIdData();
+            loadItemIds();
+            loadBlockIds();
+            // id sets
+            CHELPER_TRACE_NEXT("CPack::buildIdSets");
+            Profile::next("build id sets");
+            for (const auto &item: normalIds) {
+                if (HEDLEY_UNLIKELY(normalIdSets.find(item.first) == normalIdSets.end())) {
+                    normalIdSets.emplace(item.first, std::make_shared<IdSet>(*item.second));
+                }
             }
-        }
-        // command param nodes
-        for (const auto &item: repeatNodeData) {
-            std::vector<const Node::NodeBase *> content;
-            content.reserve(item.repeatNodes.size());
-            for (const auto &item2: item.repeatNodes) {
-                std::vector<const Node::NodeBase *> perContent;
-                perContent.reserve(item2.size());
-                for (const auto &item3: item2) {
-                    perContent.push_back(item3.get());
+            for (const auto &item: namespaceIds) {
+                if (HEDLEY_UNLIKELY(namespaceIdSets.find(item.first) == namespaceIdSets.end())) {
+                    namespaceIdSets.emplace(item.first, std::make_shared<IdSet>(*item.second));
                 }
-                auto node = std::make_unique<Node::NodeAnd>(item.id, std::nullopt, Node::WhitespaceMode::NORMAL, std::move(perContent));
-                content.push_back(node.get());
-                repeatCacheNodes.push_back(std::move(node));
             }
-            std::vector<const Node::NodeBase *> breakChildNodes;
-            breakChildNodes.reserve(item.breakNodes.size());
-            for (const auto &item2: item.breakNodes) {
-                breakChildNodes.push_back(item2.get());
+            if (HEDLEY_UNLIKELY(blockIds != nullptr && blockIds->blockStateValues != nullptr &&
+                                namespaceIdSets.find(u"blocks") == namespaceIdSets.end())) {
+                namespaceIdSets.emplace(u"blocks", std::make_shared<IdSet>(*getNamespaceId(u"blocks")));
             }
-            std::unique_ptr<Node::NodeBase> unBreakNode = std::make_unique<Node::NodeOr>(
-                    item.id, std::nullopt, std::move(content), false);
-            std::unique_ptr<Node::NodeBase> breakNode = std::make_unique<Node::NodeAnd>(
-                    item.id, std::nullopt, Node::WhitespaceMode::NORMAL, std::move(breakChildNodes));
-            std::unique_ptr<Node::NodeBase> orNode = std::make_unique<Node::NodeOr>(
-                    u"NODE_REPEAT", u"命令重复部分",
-                    std::vector<const Node::NodeBase *>{unBreakNode.get(), breakNode.get()},
-                    false);
-            repeatNodes.emplace(item.id, std::make_pair(&item, orNode.get()));
-            repeatCacheNodes.push_back(std::move(unBreakNode));
-            repeatCacheNodes.push_back(std::move(breakNode));
-            repeatCacheNodes.push_back(std::move(orNode));
-        }
-        for (const auto &item: repeatNodeData) {
-            for (const auto &item2: item.repeatNodes) {
-                for (const auto &item3: item2) {
-                    item3->init(*this);
-                }
+            if (HEDLEY_UNLIKELY(itemIds != nullptr && namespaceIdSets.find(u"items") == namespaceIdSets.end())) {
+                namespaceIdSets.emplace(u"items", std::make_shared<IdSet>(*getNamespaceId(u"items")));
             }
-            for (const auto &item2: item.breakNodes) {
-                item2->init(*this);
+            loadIdSets();
+            CHELPER_TRACE_NEXT("CPack::initJsonAndRepeatNodes");
+            Profile::next("init json nodes and repeat nodes");
+            loadJsonData();
+            // 在多个线程中初始化JSON数据时，其他线程中通过ID查找JSON数据不能等待初始化完成，所以先标记为已经初始化。
+            // 这和延迟初始化前的行为相同：JSON数据之间只通过ID链接，afterApply结束前所有JSON数据都会初始化完成
+            jsonInitSection.load([](std::istream &) {}, []() {});
+            initJsonNodes(threads);
+            initRepeatNodes();
+        }
+        CHELPER_TRACE_NEXT("CPack::initCommands");
+        Profile::next("init commands");
+        Parallel::forEach(commands->size(), threads, 4, [this](size_t i) {
+            const auto &item = (*commands)[i];
+            CHELPER_TRACE_SCOPE_ARGS("NodePerCommand::init", "{}", item->name[0]);
+            size_t stackSize = Profile::stack.size();
+            try {
+                item->init(*this);
+            } catch (...) {
+                Profile::insert(stackSize, R"(init command: "{}")", StringUtil::join(u",", item->name));
+                throw;
             }
-        }
+        });
+        CHELPER_TRACE_NEXT("CPack::sortCommandNodes");
+        Profile::next("sort command nodes");
+        // 二进制资源包中的命令在写入时已经排好序，读取时只需要检查一遍
+        auto compareCommandName = [](const auto &item1, const auto &item2) {
+            return item1.get()->name[0] < item2.get()->name[0];
+        };
+        if (HEDLEY_UNLIKELY(!std::is_sorted(commands->begin(), commands->end(), compareCommandName))) {
+            std::sort(commands->begin(), commands->end(), compareCommandName);
+        }
+        CHELPER_TRACE_NEXT("CPack::buildCommandNameIndex");
+        Profile::next("build command name index");
+        commandNames.clear();
+        std::vector<std::pair<std::shared_ptr<NormalId>, const Node::NodePerCommand *>> commandNameItems;
         for (const auto &item: *commands) {
-            Profile::next(R"(init command: "{}")", StringUtil::join(u",", item->name));
-            item->init(*this);
+            for (const auto &item2: item->name) {
+                commandNames.emplace(item2, item.get());
+                commandNameItems.emplace_back(NormalId::make(item2, item->description), item.get());
+            }
         }
-        Profile::next("sort command nodes");
-        std::sort(commands->begin(), commands->end(),
-                  [](const auto &item1, const auto &item2) {
-                      return item1.get()->name[0] < item2.get()->name[0];
-                  });
+        std::stable_sort(commandNameItems.begin(), commandNameItems.end(),
+                         [](const auto &item1, const auto &item2) {
+                             return item1.first->name < item2.first->name;
+                         });
+        commandNameIds = std::make_shared<std::vector<std::shared_ptr<NormalId>>>();
+        commandNameIdCommands.clear();
+        commandNameIds->reserve(commandNameItems.size());
+        commandNameIdCommands.reserve(commandNameItems.size());
+        for (auto &item: commandNameItems) {
+            commandNameIds->push_back(std::move(item.first));
+            commandNameIdCommands.push_back(item.second);
+        }
+        commandNameIndex = std::make_unique<NormalIdIndex>(commandNameIds);
+        CHELPER_TRACE_NEXT("CPack::createMainNode");
         Profile::next("create main node");
-        mainNode = std::make_unique<Node::NodeCommand>(u"MAIN_NODE", u"欢迎使用命令助手(作者：Yancey)", commands.get());
+        mainNode = std::make_unique<Node::NodeCommand>(u"MAIN_NODE", u"欢迎使用命令助手(作者：Yancey)", this);
+        Profile::pop();
+    }
+
+    /**
+     * 读取和初始化普通ID和命名空间ID，以及它们的搜索索引
+     */
+    void CPack::loadIdData() const {
+        // 对于外部来说，读取前后资源包的内容是一样的
+        auto *self = const_cast<CPack *>(this);
+        auto read = [self](std::istream &istream) {
+            CHELPER_TRACE_SCOPE("CPack::lazyLoadIdData");
+            Profile::push("lazy loading normal id and namespace id data");
+            readIdData(istream, *self);
+            Profile::pop();
+        };
+        auto init = [self]() {
+            CHELPER_TRACE_SCOPE("CPack::buildIdIndexes");
+            Profile::push("build id indexes");
+            for (const auto &item: self->normalIds) {
+                self->normalIdIndexes.emplace(item.first, std::make_shared<NormalIdIndex>(item.second));
+            }
+            for (const auto &item: self->namespaceIds) {
+                self->namespaceIdIndexes.emplace(item.first, std::make_shared<NamespaceIdIndex>(item.second));
+            }
+            Profile::pop();
+        };
+        idSection.load(read, init);
+    }
+
+    /**
+     * 读取和初始化物品ID，以及物品附加值节点和搜索索引
+     */
+    void CPack::loadItemIds() const {
+        auto *self = const_cast<CPack *>(this);
+        auto read = [self](std::istream &istream) {
+            CHELPER_TRACE_SCOPE("CPack::lazyLoadItemIds");
+            Profile::push("lazy loading item id data");
+            readItemIds(istream, *self);
+            Profile::pop();
+        };
+        auto init = [self]() {
+            if (HEDLEY_UNLIKELY(self->itemIds == nullptr)) {
+                return;
+            }
+            CHELPER_TRACE_SCOPE("CPack::initItemIds");
+            Profile::push("init item data nodes");
+            ItemDataNodeCache cache;
+            for (const auto &item: *self->itemIds) {
+                item->initNode(cache);
+            }
+            self->itemIdIndex = std::make_shared<NamespaceIdIndex>(std::reinterpret_pointer_cast<std::vector<std::shared_ptr<NamespaceId>>>(self->itemIds));
+            Profile::pop();
+        };
+        itemIdSection.load(read, init);
+    }
+
+    /**
+     * 读取和初始化方块ID，以及方块状态节点和搜索索引
+     */
+    void CPack::loadBlockIds() const {
+        auto *self = const_cast<CPack *>(this);
+        auto read = [self](std::istream &istream) {
+            CHELPER_TRACE_SCOPE("CPack::lazyLoadBlockIds");
+            Profile::push("lazy loading block id data");
+            readBlockIds(istream, *self);
+            Profile::pop();
+        };
+        auto init = [self]() {
+            if (HEDLEY_UNLIKELY(self->blockIds == nullptr || self->blockIds->blockStateValues == nullptr)) {
+                return;
+            }
+            CHELPER_TRACE_SCOPE("CPack::initBlockIds");
+            Profile::push("init block state nodes");
+            BlockStateNodeCache cache;
+            for (const auto &item: *self->blockIds->blockStateValues) {
+                item->initNode(self->blockIds->blockPropertyDescriptions, cache);
+            }
+            self->blockIdIndex = std::make_shared<NamespaceIdIndex>(std::reinterpret_pointer_cast<std::vector<std::shared_ptr<NamespaceId>>>(self->blockIds->blockStateValues));
+            Profile::pop();
+        };
+        blockIdSection.load(read, init);
+    }
+
+    void CPack::loadIdSets() const {
+        auto *self = const_cast<CPack *>(this);
+        auto read = [self](std::istream &istream) {
+            CHELPER_TRACE_SCOPE("CPack::lazyLoadIdSets");
+            Profile::push("lazy loading id set data");
+            readIdSets(istream, *self);
+            Profile::pop();
+        };
+        // ID列表的名字集合读取后不需要初始化，缺少的在afterApply中创建
+        idSetSection.load(read, []() {});
+    }
+
+    /**
+     * 读取JSON数据，并创建JSON数据的ID到JSON数据的映射
+     */
+    void CPack::loadJsonData() const {
+        auto *self = const_cast<CPack *>(this);
+        auto read = [self](std::istream &istream) {
+            CHELPER_TRACE_SCOPE("CPack::lazyLoadJsonData");
+            Profile::push("lazy loading json data");
+            readJsonNodes(istream, *self);
+            Profile::pop();
+        };
+        auto init = [self]() {
+            // 节点通过ID链接到JSON数据，ID相同时使用第一个
+            self->jsonNodeIds.clear();
+            self->jsonNodeIds.reserve(self->jsonNodes.size());
+            for (const auto &item: self->jsonNodes) {
+                if (HEDLEY_LIKELY(item->id.has_value())) {
+                    self->jsonNodeIds.emplace(item->id.value(), item.get());
+                }
+            }
+        };
+        jsonSection.load(read, init);
+    }
+
+    /**
+     * 读取和初始化JSON数据，第一次使用时在当前线程中初始化
+     */
+    void CPack::loadJsonNodes() const {
+        loadJsonData();
+        auto *self = const_cast<CPack *>(this);
+        jsonInitSection.load([](std::istream &) {}, [self]() {
+            self->initJsonNodes(1);
+        });
+    }
+
+    /**
+     * @param threads 初始化节点时使用的线程数量，为0时使用硬件支持的并发线程数量
+     */
+    void CPack::initJsonNodes(size_t threads) {
+        CHELPER_TRACE_SCOPE("CPack::initJsonNodes");
+        Profile::push("init json nodes");
+        // 每个节点只会修改自己的内容，可以在多个线程中同时初始化
+        Parallel::forEach(jsonNodes.size(), threads, 8, [this](size_t i) {
+            jsonNodes[i]->init(*this);
+        });
         Profile::pop();
     }
 
+    /**
+     * 读取重复部分，然后创建重复部分的节点并初始化
+     */
+    void CPack::initRepeatNodes() const {
+        auto *self = const_cast<CPack *>(this);
+        auto read = [self](std::istream &istream) {
+            CHELPER_TRACE_SCOPE("CPack::lazyLoadRepeatData");
+            Profile::push("lazy loading repeat data");
+            readRepeatData(istream, *self);
+            Profile::pop();
+        };
+        auto init = [self]() {
+            CHELPER_TRACE_SCOPE("CPack::initRepeatNodes");
+            Profile::push("init repeat nodes");
+            for (const auto &item: self->repeatNodeData) {
+                if (HEDLEY_UNLIKELY(item.repeatNodes.size() != item.isEnd.size())) {
+                    Profile::push("checking repeat node: {}", item.id);
+                    throw std::runtime_error("fail to check repeat id because repeatNodes size not equal isEnd size");
+                }
+            }
+            for (const auto &item: self->repeatNodeData) {
+                std::vector<const Node::NodeBase *> content;
+                content.reserve(item.repeatNodes.size());
+                for (const auto &item2: item.repeatNodes) {
+                    std::vector<const Node::NodeBase *> perContent;
+                    perContent.reserve(item2.size());
+                    for (const auto &item3: item2) {
+                        perContent.push_back(item3.get());
+                    }
+                    auto node = std::make_unique<Node::NodeAnd>(item.id, std::nullopt, Node::WhitespaceMode::NORMAL, std::move(perContent));
+                    content.push_back(node.get());
+                    self->repeatCacheNodes.push_back(std::move(node));
+                }
+                std::vector<const Node::NodeBase *> breakChildNodes;
+                breakChildNodes.reserve(item.breakNodes.size());
+                for (const auto &item2: item.breakNodes) {
+                    breakChildNodes.push_back(item2.get());
+                }
+                std::unique_ptr<Node::NodeBase> unBreakNode = std::make_unique<Node::NodeOr>(
+                        item.id, std::nullopt, std::move(content), false);
+                std::unique_ptr<Node::NodeBase> breakNode = std::make_unique<Node::NodeAnd>(
+                        item.id, std::nullopt, Node::WhitespaceMode::NORMAL, std::move(breakChildNodes));
+                std::unique_ptr<Node::NodeBase> orNode = std::make_unique<Node::NodeOr>(
+                        u"NODE_REPEAT", u"命令重复部分",
+                        std::vector<const Node::NodeBase *>{unBreakNode.get(), breakNode.get()},
+                        false);
+                self->repeatNodes.emplace(item.id, std::make_pair(&item, orNode.get()));
+                self->repeatCacheNodes.push_back(std::move(unBreakNode));
+                self->repeatCacheNodes.push_back(std::move(breakNode));
+                self->repeatCacheNodes.push_back(std::move(orNode));
+            }
+            // 重复部分的节点可以通过ID链接到其他重复部分，所以先创建所有重复部分再初始化
+            for (const auto &item: self->repeatNodeData) {
+                for (const auto &item2: item.repeatNodes) {
+                    for (const auto &item3: item2) {
+                        item3->init(*self);
+                    }
+                }
+                for (const auto &item2: item.breakNodes) {
+                    item2->init(*self);
+                }
+            }
+            Profile::pop();
+        };
+        repeatSection.load(read, init);
+    }
+
+    /**
+     * 读取和初始化所有延迟读取的内容，在直接使用资源包的成员变量前调用，例如写入文件
+     */
+    void CPack::loadSections() const {
+        loadIdData();
+        loadItemIds();
+        loadBlockIds();
+        loadIdSets();
+        loadJsonNodes();
+        initRepeatNodes();
+    }
+
 #ifndef CHELPER_NO_FILESYSTEM
     std::unique_ptr<CPack> CPack::createByDirectory(const std::filesystem::path &path) {
         Profile::push("start load CPack by DIRECTORY: {}", path.u16string());
@@ -265,6 +674,23 @@ namespace CHelper {
         return cpack;
     }
 
+    /**
+     * 直接从内存中读取资源包，不会复制内存，可以传入内存映射文件或者Android的AAsset_getBuffer
+     *
+     * @param owner 内存的持有者，如果不为nullptr，命令的节点、ID、JSON数据和重复部分会在第一次使用时才加载，在这之前会一直持有这段内存
+     */
+    std::unique_ptr<CPack> CPack::createByBinary(const char *data, size_t size, const std::shared_ptr<const void> &owner) {
+        MemoryStreamBuffer buffer(data, size, owner);
+        std::istream istream(&buffer);
+        std::unique_ptr<CPack> cpack = createByBinary(istream);
+        // 检查是否读完
+        if (HEDLEY_UNLIKELY(istream.peek() != std::istream::traits_type::eof())) {
+            Profile::push("binary cpack is not read completed");
+            throw std::runtime_error("binary cpack is not read completed");
+        }
+        return cpack;
+    }
+
 #ifndef CHELPER_NO_FILESYSTEM
     template<class JsonType>
     void writeJsonToFileWithCreateDirectory(const std::filesystem::path &path, const JsonType &j) {
@@ -278,6 +704,7 @@ namespace CHelper {
 #ifndef CHELPER_NO_FILESYSTEM
     void CPack::writeJsonToDirectory(const std::filesystem::path &path) const {
         using JsonValueType = rapidjson::GenericDocument<rapidjson::UTF8<>>;
+        loadSections();
         {
             JsonValueType j;
             serialization::Codec<decltype(manifest)>::template to_json<JsonValueType>(j.GetAllocator(), j, manifest);
@@ -339,6 +766,7 @@ namespace CHelper {
 
     [[nodiscard]] rapidjson::GenericDocument<rapidjson::UTF8<>> CPack::toJson() const {
         using JsonValueType = rapidjson::GenericDocument<rapidjson::UTF8<>>;
+        loadSections();
         rapidjson::GenericDocument<rapidjson::UTF8<>> result;
         result.SetObject();
         serialization::Codec<decltype(manifest)>::template to_json_member<JsonValueType>(result.GetAllocator(), result, "manifest", manifest);
@@ -392,21 +820,38 @@ namespace CHelper {
     void CPack::writeBinToFile(const std::filesystem::path &path) const {
         std::filesystem::create_directories(path.parent_path());
         Profile::push("writing binary cpack to file: {}", path.u16string());
+        loadSections();
         std::ofstream ostream(path, std::ios::binary);
+        //format
+        serialization::Codec<uint32_t>::template to_binary<true>(ostream, BINARY_MAGIC);
+        serialization::Codec<uint32_t>::template to_binary<true>(ostream, BINARY_FORMAT_VERSION);
         //manifest
         serialization::template to_binary<true>(ostream, manifest);
-        //normal id
-        serialization::template to_binary<true>(ostream, normalIds);
-        //namespace id
-        serialization::template to_binary<true>(ostream, namespaceIds);
+        //normal id and namespace id
+        LazySection::write(ostream, [this](std::ostream &stream) {
+            IdStringTable::toBinary(stream, normalIds, namespaceIds);
+        });
         //item id
-        serialization::template to_binary<true>(ostream, itemIds);
+        LazySection::write(ostream, [this](std::ostream &stream) {
+            serialization::template to_binary<true>(stream, itemIds);
+        });
         //block id
-        serialization::template to_binary<true>(ostream, blockIds);
+        LazySection::write(ostream, [this](std::ostream &stream) {
+            serialization::template to_binary<true>(stream, blockIds);
+        });
+        //id set
+        LazySection::write(ostream, [this](std::ostream &stream) {
+            serialization::template to_binary<true>(stream, normalIdSets);
+            serialization::template to_binary<true>(stream, namespaceIdSets);
+        });
         //json node
-        serialization::template to_binary<true>(ostream, jsonNodes);
+        LazySection::write(ostream, [this](std::ostream &stream) {
+            serialization::template to_binary<true>(stream, jsonNodes);
+        });
         //repeat node
-        serialization::template to_binary<true>(ostream, repeatNodeData);
+        LazySection::write(ostream, [this](std::ostream &stream) {
+            serialization::template to_binary<true>(stream, repeatNodeData);
+        });
         //command
         serialization::template to_binary<true>(ostream, commands);
 
@@ -417,6 +862,7 @@ namespace CHelper {
 
     std::shared_ptr<std::vector<std::shared_ptr<NormalId>>>
     CPack::getNormalId(const std::u16string &key) const {
+        loadIdData();
         auto it = normalIds.find(key);
         if (HEDLEY_UNLIKELY(it == normalIds.end())) {
 #ifdef CHelperDebug
@@ -430,10 +876,13 @@ namespace CHelper {
     std::shared_ptr<std::vector<std::shared_ptr<NamespaceId>>>
     CPack::getNamespaceId(const std::u16string &key) const {
         if (HEDLEY_UNLIKELY(key == u"blocks")) {
+            loadBlockIds();
             return std::reinterpret_pointer_cast<std::vector<std::shared_ptr<NamespaceId>>>(blockIds->blockStateValues);
         } else if (HEDLEY_UNLIKELY(key == u"items")) {
+            loadItemIds();
             return std::reinterpret_pointer_cast<std::vector<std::shared_ptr<NamespaceId>>>(itemIds);
         }
+        loadIdData();
         auto it = namespaceIds.find(key);
         if (HEDLEY_UNLIKELY(it == namespaceIds.end())) {
 #ifdef CHelperDebug
@@ -444,4 +893,119 @@ namespace CHelper {
         return it->second;
     }
 
+    std::shared_ptr<BlockIds>
+    CPack::getBlockIds() const {
+        loadBlockIds();
+        return blockIds;
+    }
+
+    std::shared_ptr<std::vector<std::shared_ptr<ItemId>>>
+    CPack::getItemIds() const {
+        loadItemIds();
+        return itemIds;
+    }
+
+    const Node::NodeJsonElement *
+    CPack::getJsonNode(const std::u16string_view &id) const {
+        loadJsonNodes();
+        auto it = jsonNodeIds.find(id);
+        if (HEDLEY_UNLIKELY(it == jsonNodeIds.end())) {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    std::pair<const RepeatData *, const Node::NodeBase *>
+    CPack::getRepeatNode(const std::u16string &key) const {
+        initRepeatNodes();
+        auto it = repeatNodes.find(key);
+        if (HEDLEY_UNLIKELY(it == repeatNodes.end())) {
+            return {nullptr, nullptr};
+        }
+        return it->second;
+    }
+
+    const Node::NodePerCommand *
+    CPack::getCommand(const std::u16string_view &name) const {
+        auto it = commandNames.find(name);
+        if (HEDLEY_UNLIKELY(it == commandNames.end())) {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    /**
+     * 搜索命令名字，依次为名字开头匹配、名字包含、介绍包含的命令名字，每一部分按名字排序
+     */
+    std::vector<std::shared_ptr<NormalId>>
+    CPack::searchCommandName(const std::u16string_view &str) const {
+        std::vector<uint32_t> nameStartOf, nameContain, descriptionContain;
+        commandNameIndex->search(str, nameStartOf, nameContain, descriptionContain);
+        std::vector<std::shared_ptr<NormalId>> result;
+        result.reserve(nameStartOf.size() + nameContain.size() + descriptionContain.size());
+        std::vector<const Node::NodePerCommand *> nameMatchCommands;
+        nameMatchCommands.reserve(nameStartOf.size() + nameContain.size());
+        for (const auto &item: {&nameStartOf, &nameContain}) {
+            for (uint32_t index: *item) {
+                result.push_back(commandNameIds->at(index));
+                nameMatchCommands.push_back(commandNameIdCommands[index]);
+            }
+        }
+        //有名字匹配的命令，它的其他名字不再通过介绍进行匹配
+        std::sort(nameMatchCommands.begin(), nameMatchCommands.end());
+        for (uint32_t index: descriptionContain) {
+            if (HEDLEY_LIKELY(!std::binary_search(nameMatchCommands.begin(), nameMatchCommands.end(), commandNameIdCommands[index]))) {
+                result.push_back(commandNameIds->at(index));
+            }
+        }
+        return result;
+    }
+
+    std::shared_ptr<IdSet>
+    CPack::getNormalIdSet(const std::u16string &key) const {
+        loadIdSets();
+        auto it = normalIdSets.find(key);
+        if (HEDLEY_UNLIKELY(it == normalIdSets.end())) {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    std::shared_ptr<IdSet>
+    CPack::getNamespaceIdSet(const std::u16string &key) const {
+        loadIdSets();
+        auto it = namespaceIdSets.find(key);
+        if (HEDLEY_UNLIKELY(it == namespaceIdSets.end())) {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    std::shared_ptr<NormalIdIndex>
+    CPack::getNormalIdIndex(const std::u16string &key) const {
+        loadIdData();
+        auto it = normalIdIndexes.find(key);
+        if (HEDLEY_UNLIKELY(it == normalIdIndexes.end())) {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    std::shared_ptr<NamespaceIdIndex>
+    CPack::getNamespaceIdIndex(const std::u16string &key) const {
+        if (HEDLEY_UNLIKELY(key == u"blocks")) {
+            loadBlockIds();
+            return blockIdIndex;
+        } else if (HEDLEY_UNLIKELY(key == u"items")) {
+            loadItemIds();
+            return itemIdIndex;
+        }
+        loadIdData();
+        auto it = namespaceIdIndexes.find(key);
+        if (HEDLEY_UNLIKELY(it == namespaceIdIndexes.end())) {
+            return nullptr;
+        }
+        return it->second;
+    }
+
 }// namespace CHelper
@@ -0,0 +1,13 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/resources/LazySection.h>
+
+namespace CHelper {
+
+    bool LazySection::isDeferred() const {
+        return data != nullptr;
+    }
+
+}// namespace CHelper
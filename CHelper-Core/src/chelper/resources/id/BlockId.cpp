@@ -284,11 +284,45 @@ namespace CHelper {
         }
     }
 
+    void appendPropertyValueKey(std::u16string &key, const PropertyType::PropertyType &type, const PropertyValue &value) {
+        switch (type) {
+            case PropertyType::STRING:
+                key.append(*value.string);
+                break;
+            case PropertyType::BOOLEAN:
+                key.append(value.boolean ? u"true" : u"false");
+                break;
+            case PropertyType::INTEGER:
+                key.append(utf8::utf8to16(std::to_string(value.integer)));
+                break;
+            default:
+                HEDLEY_UNREACHABLE();
+        }
+        key.push_back(u'\0');
+    }
+
+    //方块状态键值对在缓存中的键，由默认值和有效值组成，值之间用'\0'分隔
+    std::u16string getBlockStateNodeKey(
+            const PropertyType::PropertyType &type,
+            PropertyValue defaultValue,
+            const std::optional<std::vector<PropertyValue>> &valid) {
+        std::u16string key;
+        appendPropertyValueKey(key, type, defaultValue);
+        if (valid.has_value()) {
+            key.push_back(u'[');
+            for (const auto &item: valid.value()) {
+                appendPropertyValueKey(key, type, item);
+            }
+        }
+        return key;
+    }
+
     std::shared_ptr<Node::NodeBase> getBlockStateNode(
-            std::vector<std::shared_ptr<Node::NodeBase>> &nodeChildren,
             const BlockPropertyDescription &blockPropertyDescription,
             PropertyValue defaultValue,
             const std::optional<std::vector<PropertyValue>> &valid) {
+        auto nodeChildren = std::make_shared<std::vector<std::shared_ptr<Node::NodeBase>>>();
+        nodeChildren->reserve(blockPropertyDescription.values.size() + 3);
         std::vector<const Node::NodeBase *> valueNodes;
         valueNodes.reserve(blockPropertyDescription.values.size());
         for (auto &item: blockPropertyDescription.values) {
@@ -344,7 +378,7 @@ namespace CHelper {
                     item, blockPropertyDescription.type,
                     blockPropertyDescription.description, isDefaultValue, isInvalid);
             valueNodes.push_back(node.get());
-            nodeChildren.push_back(std::move(node));
+            nodeChildren->push_back(std::move(node));
         }
         //key = value
         auto nodeKey = std::make_shared<Node::NodeText>(
@@ -358,53 +392,72 @@ namespace CHelper {
                 nodeKey.get(),
                 nodeBlockStateEntrySeparator.get(),
                 nodeValue.get());
-        nodeChildren.push_back(std::move(nodeKey));
-        nodeChildren.push_back(std::move(nodeValue));
-        return std::move(result);
+        nodeChildren->push_back(std::move(nodeKey));
+        nodeChildren->push_back(std::move(nodeValue));
+        nodeChildren->push_back(result);
+        //返回的节点同时持有所有子节点
+        return {nodeChildren, result.get()};
     }
 
-    std::shared_ptr<Node::NodeBase> BlockId::getNode(const BlockPropertyDescriptions &blockPropertyDescriptions) {
-        if (node == nullptr) {
-            std::vector<const Node::NodeBase *> blockStateEntryChildNode2;
+    void BlockId::initNode(const BlockPropertyDescriptions &blockPropertyDescriptions, BlockStateNodeCache &cache) {
+        if (HEDLEY_LIKELY(node == nullptr)) {
+            auto nodeChildren = std::make_shared<std::vector<std::shared_ptr<Node::NodeBase>>>();
             //已知的方块状态
+            std::optional<std::vector<const Node::NodeBase *>> blockStateEntryChildNode1;
             if (HEDLEY_LIKELY(properties.has_value())) {
-                blockStateEntryChildNode2.reserve(2);
-                std::vector<const Node::NodeBase *> blockStateEntryChildNode1;
-                blockStateEntryChildNode1.reserve(properties.value().size());
-                std::transform(properties.value().begin(), properties.value().end(),
-                               std::back_inserter(blockStateEntryChildNode1),
-                               [this, &blockPropertyDescriptions](const auto &item) -> const Node::NodeBase * {
-                                   const BlockPropertyDescription &blockPropertyDescription = blockPropertyDescriptions.getPropertyDescription(
-                                           getIdWithNamespace()->name,
-                                           name,
-                                           item.name);
-                                   std::shared_ptr<Node::NodeBase> node1 = getBlockStateNode(
-                                           nodeChildren, blockPropertyDescription,
-                                           item.defaultValue, item.valid);
-                                   Node::NodeBase *nodePtr = node1.get();
-                                   nodeChildren.push_back(std::move(node1));
-                                   return nodePtr;
-                               });
+                blockStateEntryChildNode1.emplace();
+                blockStateEntryChildNode1->reserve(properties.value().size());
+                nodeChildren->reserve(properties.value().size() + 3);
+                for (const auto &item: properties.value()) {
+                    const BlockPropertyDescription &blockPropertyDescription = blockPropertyDescriptions.getPropertyDescription(
+                            getIdWithNamespace()->name,
+                            name,
+                            item.name);
+                    auto &node1 = cache.entryNodes[std::make_pair(
+                            &blockPropertyDescription,
+                            getBlockStateNodeKey(blockPropertyDescription.type, item.defaultValue, item.valid))];
+                    if (HEDLEY_UNLIKELY(node1 == nullptr)) {
+                        node1 = getBlockStateNode(blockPropertyDescription, item.defaultValue, item.valid);
+                    }
+                    blockStateEntryChildNode1->push_back(node1.get());
+                    nodeChildren->push_back(node1);
+                }
+            }
+            auto &cacheNode = cache.blockStateNodes[blockStateEntryChildNode1];
+            if (HEDLEY_LIKELY(cacheNode != nullptr)) {
+                node = cacheNode;
+                return;
+            }
+            std::vector<const Node::NodeBase *> blockStateEntryChildNode2;
+            blockStateEntryChildNode2.reserve(2);
+            if (HEDLEY_LIKELY(blockStateEntryChildNode1.has_value())) {
                 auto nodeChild = std::make_shared<Node::NodeOr>(
                         u"BLOCK_STATE_ENTRY", u"方块状态键值对",
-                        std::move(blockStateEntryChildNode1), false);
+                        std::move(blockStateEntryChildNode1.value()), false);
                 blockStateEntryChildNode2.push_back(nodeChild.get());
-                nodeChildren.push_back(std::move(nodeChild));
+                nodeChildren->push_back(std::move(nodeChild));
             }
             //其他未知的方块状态
             blockStateEntryChildNode2.push_back(nodeBlockStateAllEntry.get());
             //把所有方块状态拼在一起
             auto nodeValue = std::make_shared<Node::NodeOr>(u"BLOCK_STATE_ENTRY", u"方块状态键值对",
                                                             std::move(blockStateEntryChildNode2), false, true);
-            node = std::make_shared<Node::NodeList>(
+            auto nodeList = std::make_shared<Node::NodeList>(
                     u"BLOCK_STATE",
                     u"方块状态",
                     nodeBlockStateLeftBracket.get(),
                     nodeValue.get(),
                     nodeBlockStateSeparator.get(),
                     nodeBlockStateRightBracket.get());
-            nodeChildren.push_back(std::move(nodeValue));
+            nodeChildren->push_back(std::move(nodeValue));
+            nodeChildren->push_back(nodeList);
+            //返回的节点同时持有所有子节点
+            node = std::shared_ptr<Node::NodeBase>(nodeChildren, nodeList.get());
+            cacheNode = node;
         }
+    }
+
+    const std::shared_ptr<Node::NodeBase> &BlockId::getNode() const {
         return node;
     }
 
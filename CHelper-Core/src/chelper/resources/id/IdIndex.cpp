@@ -0,0 +1,184 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/resources/id/IdIndex.h>
+
+namespace CHelper {
+
+    static uint32_t getBigram(char16_t ch1, char16_t ch2) {
+        return (static_cast<uint32_t>(ch1) << 16) | ch2;
+    }
+
+    template<class T>
+    static void addPosting(std::unordered_map<T, std::vector<uint32_t>> &postings, T key, uint32_t index) {
+        std::vector<uint32_t> &posting = postings[key];
+        // 下标是按顺序添加的，同一个字符串中重复出现的字符只需要记录一次
+        if (HEDLEY_LIKELY(posting.empty() || posting.back() != index)) {
+            posting.push_back(index);
+        }
+    }
+
+    StringIndex::StringIndex(std::vector<const std::u16string *> strings0)
+        : strings(std::move(strings0)) {
+        for (uint32_t i = 0; i < strings.size(); ++i) {
+            const std::u16string *str = strings[i];
+            if (HEDLEY_UNLIKELY(str == nullptr)) {
+                continue;
+            }
+            sorted.push_back(i);
+            for (size_t j = 0; j < str->length(); ++j) {
+                addPosting(unigrams, (*str)[j], i);
+                if (HEDLEY_LIKELY(j + 1 < str->length())) {
+                    addPosting(bigrams, getBigram((*str)[j], (*str)[j + 1]), i);
+                }
+            }
+        }
+        std::stable_sort(sorted.begin(), sorted.end(), [this](uint32_t a, uint32_t b) {
+            return *strings[a] < *strings[b];
+        });
+    }
+
+    std::vector<uint32_t> StringIndex::startsWith(const std::u16string_view &prefix) const {
+        if (HEDLEY_UNLIKELY(prefix.empty())) {
+            return all();
+        }
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), prefix, [this](uint32_t a, const std::u16string_view &b) {
+            return std::u16string_view(*strings[a]) < b;
+        });
+        std::vector<uint32_t> result;
+        for (; it != sorted.end(); ++it) {
+            std::u16string_view str = *strings[*it];
+            if (HEDLEY_LIKELY(str.substr(0, prefix.length()) != prefix)) {
+                break;
+            }
+            result.push_back(*it);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    std::vector<uint32_t> StringIndex::contains(const std::u16string_view &str) const {
+        if (HEDLEY_UNLIKELY(str.empty())) {
+            return all();
+        }
+        if (HEDLEY_UNLIKELY(str.length() == 1)) {
+            auto it = unigrams.find(str[0]);
+            return it == unigrams.end() ? std::vector<uint32_t>() : it->second;
+        }
+        // 找到最短的倒排表，再逐个检查
+        const std::vector<uint32_t> *candidates = nullptr;
+        for (size_t i = 0; i + 1 < str.length(); ++i) {
+            auto it = bigrams.find(getBigram(str[i], str[i + 1]));
+            if (HEDLEY_UNLIKELY(it == bigrams.end())) {
+                return {};
+            }
+            if (HEDLEY_LIKELY(candidates == nullptr || it->second.size() < candidates->size())) {
+                candidates = &it->second;
+            }
+        }
+        std::vector<uint32_t> result;
+        for (uint32_t index: *candidates) {
+            if (HEDLEY_UNLIKELY(strings[index]->find(str) != std::u16string::npos)) {
+                result.push_back(index);
+            }
+        }
+        return result;
+    }
+
+    std::vector<uint32_t> StringIndex::all() const {
+        std::vector<uint32_t> result = sorted;
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    static std::vector<uint32_t> difference(const std::vector<uint32_t> &a, const std::vector<uint32_t> &b) {
+        std::vector<uint32_t> result;
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(result));
+        return result;
+    }
+
+    template<class T>
+    static std::vector<const std::u16string *> getDescriptions(const std::vector<std::shared_ptr<T>> &contents) {
+        std::vector<const std::u16string *> result;
+        result.reserve(contents.size());
+        for (const auto &item: contents) {
+            result.push_back(item->description.has_value() ? &item->description.value() : nullptr);
+        }
+        return result;
+    }
+
+    static std::vector<const std::u16string *> getNames(const std::vector<std::shared_ptr<NormalId>> &contents) {
+        std::vector<const std::u16string *> result;
+        result.reserve(contents.size());
+        for (const auto &item: contents) {
+            result.push_back(&item->name);
+        }
+        return result;
+    }
+
+    NormalIdIndex::NormalIdIndex(std::shared_ptr<std::vector<std::shared_ptr<NormalId>>> contents)
+        : contents(std::move(contents)) {}
+
+    void NormalIdIndex::search(const std::u16string_view &str,
+                               std::vector<uint32_t> &nameStartOf,
+                               std::vector<uint32_t> &nameContain,
+                               std::vector<uint32_t> &descriptionContain) const {
+        std::call_once(buildFlag, [this]() {
+            names.emplace(getNames(*contents));
+            descriptions.emplace(getDescriptions(*contents));
+        });
+        nameStartOf = names->startsWith(str);
+        std::vector<uint32_t> nameMatch = names->contains(str);
+        nameContain = difference(nameMatch, nameStartOf);
+        //名字已经匹配的ID不再通过介绍进行匹配
+        descriptionContain = difference(descriptions->contains(str), nameMatch);
+    }
+
+    static std::vector<const std::u16string *> getNames(const std::vector<std::shared_ptr<NamespaceId>> &contents) {
+        std::vector<const std::u16string *> result;
+        result.reserve(contents.size());
+        for (const auto &item: contents) {
+            //省略minecraft命名空间
+            if (HEDLEY_LIKELY(!item->idNamespace.has_value() || item->idNamespace.value() == u"minecraft")) {
+                result.push_back(&item->name);
+            } else {
+                result.push_back(nullptr);
+            }
+        }
+        return result;
+    }
+
+    static std::vector<const std::u16string *> getNamespaceNames(const std::vector<std::shared_ptr<NamespaceId>> &contents) {
+        std::vector<const std::u16string *> result;
+        result.reserve(contents.size());
+        for (const auto &item: contents) {
+            result.push_back(&item->getIdWithNamespace()->name);
+        }
+        return result;
+    }
+
+    NamespaceIdIndex::NamespaceIdIndex(std::shared_ptr<std::vector<std::shared_ptr<NamespaceId>>> contents)
+        : contents(std::move(contents)) {}
+
+    void NamespaceIdIndex::search(const std::u16string_view &str,
+                                  std::vector<uint32_t> &nameStartOf,
+                                  std::vector<uint32_t> &nameContain,
+                                  std::vector<uint32_t> &namespaceStartOf,
+                                  std::vector<uint32_t> &namespaceContain,
+                                  std::vector<uint32_t> &descriptionContain) const {
+        std::call_once(buildFlag, [this]() {
+            names.emplace(getNames(*contents));
+            namespaceNames.emplace(getNamespaceNames(*contents));
+            descriptions.emplace(getDescriptions(*contents));
+        });
+        nameStartOf = names->startsWith(str);
+        nameContain = difference(names->contains(str), nameStartOf);
+        namespaceStartOf = namespaceNames->startsWith(str);
+        std::vector<uint32_t> namespaceMatch = namespaceNames->contains(str);
+        namespaceContain = difference(namespaceMatch, namespaceStartOf);
+        //带有命名空间的ID已经匹配的ID不再通过介绍进行匹配
+        descriptionContain = difference(descriptions->contains(str), namespaceMatch);
+    }
+
+}// namespace CHelper
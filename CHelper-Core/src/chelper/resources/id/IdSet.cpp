@@ -0,0 +1,76 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/resources/id/IdSet.h>
+
+namespace CHelper {
+
+    IdSet::IdSet(const std::vector<std::shared_ptr<NormalId>> &contents) {
+        reserve(contents.size());
+        for (const auto &item: contents) {
+            insert(item->name);
+        }
+    }
+
+    IdSet::IdSet(const std::vector<std::shared_ptr<NamespaceId>> &contents) {
+        reserve(2 * contents.size());
+        for (const auto &item: contents) {
+            insert(item->name);
+            insert(item->getIdWithNamespace()->name);
+        }
+    }
+
+    bool IdSet::contains(const std::u16string_view &str) const {
+        if (HEDLEY_UNLIKELY(slots.empty())) {
+            return false;
+        }
+        uint64_t strHash = hash(str);
+        size_t mask = slots.size() - 1;
+        // 从损坏的资源包中读取的集合可能没有空位置，最多检查整个表，避免死循环
+        size_t i = strHash & mask;
+        for (size_t probeCount = 0; probeCount < slots.size(); ++probeCount, i = (i + 1) & mask) {
+            if (HEDLEY_LIKELY(slots[i] == strHash)) {
+                return true;
+            }
+            if (HEDLEY_LIKELY(slots[i] == 0)) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    uint64_t IdSet::hash(const std::u16string_view &str) {
+        uint64_t result = 14695981039346656037ULL;
+        for (char16_t ch: str) {
+            result ^= static_cast<uint64_t>(ch);
+            result *= 1099511628211ULL;
+        }
+        // 0表示空位置
+        return HEDLEY_UNLIKELY(result == 0) ? 1 : result;
+    }
+
+    void IdSet::reserve(size_t size) {
+        // 负载因子不超过0.5，保证一定有空位置
+        size_t capacity = 2;
+        while (capacity < 2 * size) {
+            capacity <<= 1;
+        }
+        slots.assign(capacity, 0);
+    }
+
+    void IdSet::insert(const std::u16string_view &str) {
+        uint64_t strHash = hash(str);
+        size_t mask = slots.size() - 1;
+        for (size_t i = strHash & mask;; i = (i + 1) & mask) {
+            if (HEDLEY_UNLIKELY(slots[i] == strHash)) {
+                return;
+            }
+            if (HEDLEY_LIKELY(slots[i] == 0)) {
+                slots[i] = strHash;
+                return;
+            }
+        }
+    }
+
+}// namespace CHelper
@@ -0,0 +1,126 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/resources/id/IdStringTable.h>
+
+namespace CHelper::IdStringTable {
+
+    static void writeIndex(std::ostream &ostream, uint32_t index) {
+        serialization::Codec<uint32_t>::template to_binary<true>(ostream, index);
+    }
+
+    static uint32_t readIndex(std::istream &istream) {
+        uint32_t index = 0;
+        serialization::Codec<uint32_t>::template from_binary<true>(istream, index);
+        if (HEDLEY_UNLIKELY(!istream)) {
+            Profile::push("unexpected end of id string table");
+            throw std::runtime_error("unexpected end of id string table");
+        }
+        return index;
+    }
+
+    /**
+     * 损坏的资源包中的数量可能非常大，不能直接用来分配内存。从内存中读取时用剩余的字节数检查数量，
+     * 其他情况无法知道剩余的字节数，不预先分配内存，读取的内容不够时readIndex会抛出异常
+     *
+     * @param minSize 每一项至少占用的字节数
+     * @return 可以预先分配的数量
+     */
+    static size_t checkCount(std::istream &istream, uint32_t count, size_t minSize, const char *name) {
+        auto *buffer = dynamic_cast<MemoryStreamBuffer *>(istream.rdbuf());
+        if (HEDLEY_UNLIKELY(buffer == nullptr)) {
+            return 0;
+        }
+        if (HEDLEY_UNLIKELY(static_cast<uint64_t>(count) * minSize > buffer->getRemaining())) {
+            Profile::push("{} count {} is out of range, only {} bytes remain", name, count, buffer->getRemaining());
+            throw std::runtime_error("id string table count is out of range");
+        }
+        return count;
+    }
+
+    template<class IdType>
+    static void writeIds(std::ostream &ostream, StringPool &stringPool,
+                         const std::unordered_map<std::u16string, std::shared_ptr<std::vector<std::shared_ptr<IdType>>>> &ids) {
+        writeIndex(ostream, static_cast<uint32_t>(ids.size()));
+        for (const auto &item: ids) {
+            writeIndex(ostream, stringPool.intern(std::u16string_view(item.first)));
+            writeIndex(ostream, static_cast<uint32_t>(item.second->size()));
+            for (const auto &id: *item.second) {
+                writeIndex(ostream, stringPool.intern(std::u16string_view(id->name)));
+                writeIndex(ostream, stringPool.intern(id->description));
+                if constexpr (std::is_same_v<IdType, NamespaceId>) {
+                    writeIndex(ostream, stringPool.intern(id->idNamespace));
+                }
+            }
+        }
+    }
+
+    template<class IdType>
+    static void readIds(std::istream &istream, const std::vector<std::u16string> &strings,
+                        std::unordered_map<std::u16string, std::shared_ptr<std::vector<std::shared_ptr<IdType>>>> &ids) {
+        auto getString = [&strings](uint32_t index) -> const std::u16string & {
+            if (HEDLEY_UNLIKELY(index >= strings.size())) {
+                Profile::push("string index out of range -> {}", index);
+                throw std::runtime_error("string index out of range");
+            }
+            return strings[index];
+        };
+        auto getOptionalString = [&getString](uint32_t index) -> std::optional<std::u16string> {
+            if (HEDLEY_UNLIKELY(index == StringPool::NONE)) {
+                return std::nullopt;
+            }
+            return getString(index);
+        };
+        // ID列表的每一项至少有名字和数量两个编号，每个ID至少有名字和介绍两个编号，命名空间ID还有命名空间的编号
+        constexpr size_t idSize = std::is_same_v<IdType, NamespaceId> ? 3 * sizeof(uint32_t) : 2 * sizeof(uint32_t);
+        uint32_t mapSize = readIndex(istream);
+        ids.reserve(ids.size() + checkCount(istream, mapSize, 2 * sizeof(uint32_t), "id list"));
+        for (uint32_t i = 0; i < mapSize; ++i) {
+            const std::u16string &key = getString(readIndex(istream));
+            uint32_t size = readIndex(istream);
+            auto content = std::make_shared<std::vector<std::shared_ptr<IdType>>>();
+            content->reserve(checkCount(istream, size, idSize, "id"));
+            for (uint32_t j = 0; j < size; ++j) {
+                auto id = std::make_shared<IdType>();
+                id->name = getString(readIndex(istream));
+                id->description = getOptionalString(readIndex(istream));
+                if constexpr (std::is_same_v<IdType, NamespaceId>) {
+                    id->idNamespace = getOptionalString(readIndex(istream));
+                }
+                content->push_back(std::move(id));
+            }
+            ids.emplace(key, std::move(content));
+        }
+    }
+
+    void toBinary(std::ostream &ostream, const NormalIds &normalIds, const NamespaceIds &namespaceIds) {
+        // 先写入ID，得到所有字符串后再把字符串表写在ID的前面
+        StringPool stringPool;
+        std::ostringstream idStream;
+        writeIds(idStream, stringPool, normalIds);
+        writeIds(idStream, stringPool, namespaceIds);
+        writeIndex(ostream, static_cast<uint32_t>(stringPool.size()));
+        for (const auto &item: stringPool.getStrings()) {
+            serialization::Codec<std::u16string>::template to_binary<true>(ostream, item);
+        }
+        std::string idData = std::move(idStream).str();
+        ostream.write(idData.data(), static_cast<std::streamsize>(idData.size()));
+    }
+
+    void fromBinary(std::istream &istream, NormalIds &normalIds, NamespaceIds &namespaceIds) {
+        uint32_t stringCount = readIndex(istream);
+        std::vector<std::u16string> strings;
+        strings.reserve(checkCount(istream, stringCount, 1, "string"));
+        for (uint32_t i = 0; i < stringCount; ++i) {
+            serialization::Codec<std::u16string>::template from_binary<true>(istream, strings.emplace_back());
+            if (HEDLEY_UNLIKELY(!istream)) {
+                Profile::push("fail to read string {} of {} in id string table", i, stringCount);
+                throw std::runtime_error("fail to read id string table");
+            }
+        }
+        readIds(istream, strings, normalIds);
+        readIds(istream, strings, namespaceIds);
+    }
+
+}// namespace CHelper::IdStringTable
@@ -9,16 +9,22 @@
 
 namespace CHelper {
 
-    std::shared_ptr<Node::NodeBase> ItemId::getNode() {
-        if (HEDLEY_UNLIKELY(node == nullptr)) {
+    void ItemId::initNode(ItemDataNodeCache &cache) {
+        if (HEDLEY_LIKELY(node == nullptr)) {
             if (HEDLEY_UNLIKELY(max.has_value() && max.value() < 0)) {
                 throw std::runtime_error("item id max data value should be a positive number");
             }
+            auto &cacheNode = cache[std::make_pair(max, descriptions)];
+            if (HEDLEY_LIKELY(cacheNode != nullptr)) {
+                node = cacheNode;
+                return;
+            }
             auto nodeAllData = std::shared_ptr<Node::NodeInteger>(Node::NodeInteger::make(u"ITEM_DATA", u"物品附加值", -1, max));
             if (HEDLEY_LIKELY(!descriptions.has_value())) {
                 node = std::move(nodeAllData);
             } else {
-                nodeChildren.push_back(nodeAllData);
+                auto nodeChildren = std::make_shared<std::vector<std::shared_ptr<Node::NodeBase>>>();
+                nodeChildren->push_back(nodeAllData);
                 std::vector<const Node::NodeBase *> nodeDataChildren;
                 nodeDataChildren.reserve(descriptions.value().size());
                 size_t i = 0;
@@ -30,18 +36,25 @@ namespace CHelper {
                                 return tokenReader.readIntegerASTNode(node1);
                             });
                     nodeDataChildren.push_back(nodeChild.get());
-                    nodeChildren.push_back(std::move(nodeChild));
+                    nodeChildren->push_back(std::move(nodeChild));
                 }
                 auto nodeOr = std::make_shared<Node::NodeOr>(
                         u"ITEM_DATA", u"物品附加值",
                         std::move(nodeDataChildren), false);
-                node = std::make_shared<Node::NodeOr>(
+                auto nodeData = std::make_shared<Node::NodeOr>(
                         u"ITEM_DATA", u"物品附加值",
                         std::vector<const Node::NodeBase *>{nodeOr.get(), nodeAllData.get()},
                         false, true);
-                nodeChildren.push_back(std::move(nodeOr));
+                nodeChildren->push_back(std::move(nodeOr));
+                nodeChildren->push_back(nodeData);
+                //返回的节点同时持有所有子节点
+                node = std::shared_ptr<Node::NodeBase>(nodeChildren, nodeData.get());
             }
+            cacheNode = node;
         }
+    }
+
+    const std::shared_ptr<Node::NodeBase> &ItemId::getNode() const {
         return node;
     }
 
@@ -34,4 +34,25 @@ namespace CHelper {
         colorLiteral = COLOR_LIGHT_BLUE;
     }
 
+    bool Theme::operator==(const Theme &theme) const {
+        return colorBoolean == theme.colorBoolean &&
+               colorFloat == theme.colorFloat &&
+               colorInteger == theme.colorInteger &&
+               colorSymbol == theme.colorSymbol &&
+               colorId == theme.colorId &&
+               colorTargetSelector == theme.colorTargetSelector &&
+               colorCommand == theme.colorCommand &&
+               colorBrackets1 == theme.colorBrackets1 &&
+               colorBrackets2 == theme.colorBrackets2 &&
+               colorBrackets3 == theme.colorBrackets3 &&
+               colorString == theme.colorString &&
+               colorNull == theme.colorNull &&
+               colorRange == theme.colorRange &&
+               colorLiteral == theme.colorLiteral;
+    }
+
+    bool Theme::operator!=(const Theme &theme) const {
+        return !(*this == theme);
+    }
+
 }// namespace CHelper
\ No newline at end of file
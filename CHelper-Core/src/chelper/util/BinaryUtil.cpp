@@ -4,8 +4,111 @@
 
 #include <chelper/util/BinaryUtil.h>
 
+#if !defined(CHELPER_NO_FILESYSTEM) && !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace CHelper {
 
+    MemoryStreamBuffer::MemoryStreamBuffer(const char *data, size_t size, std::shared_ptr<const void> owner)
+        : owner(std::move(owner)) {
+        // streambuf的接口需要char*，但是只会读取，不会修改内存
+        char *begin = const_cast<char *>(data);
+        setg(begin, begin, begin + size);
+    }
+
+    const std::shared_ptr<const void> &MemoryStreamBuffer::getOwner() const {
+        return owner;
+    }
+
+    const char *MemoryStreamBuffer::getCurrent() const {
+        return gptr();
+    }
+
+    size_t MemoryStreamBuffer::getRemaining() const {
+        return static_cast<size_t>(egptr() - gptr());
+    }
+
+    MemoryStreamBuffer::pos_type MemoryStreamBuffer::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) {
+        if (HEDLEY_UNLIKELY(!(which & std::ios_base::in))) {
+            return {off_type(-1)};
+        }
+        char *target;
+        if (dir == std::ios_base::beg) {
+            target = eback() + off;
+        } else if (dir == std::ios_base::cur) {
+            target = gptr() + off;
+        } else {
+            target = egptr() + off;
+        }
+        if (HEDLEY_UNLIKELY(target < eback() || target > egptr())) {
+            return {off_type(-1)};
+        }
+        setg(eback(), target, egptr());
+        return {target - eback()};
+    }
+
+    MemoryStreamBuffer::pos_type MemoryStreamBuffer::seekpos(pos_type pos, std::ios_base::openmode which) {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+#ifndef CHELPER_NO_FILESYSTEM
+    MappedFile::MappedFile(const std::filesystem::path &path) {
+#if defined(_WIN32)
+        std::ifstream is(path, std::ios::binary | std::ios::ate);
+        if (HEDLEY_UNLIKELY(!is.is_open())) {
+            throw std::runtime_error("fail to read file");
+        }
+        buffer.resize(static_cast<size_t>(is.tellg()));
+        is.seekg(0);
+        is.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        data = buffer.data();
+        size = buffer.size();
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (HEDLEY_UNLIKELY(fd < 0)) {
+            throw std::runtime_error("fail to read file");
+        }
+        struct stat fileStat {};
+        if (HEDLEY_UNLIKELY(fstat(fd, &fileStat) != 0)) {
+            close(fd);
+            throw std::runtime_error("fail to read file");
+        }
+        size = static_cast<size_t>(fileStat.st_size);
+        if (HEDLEY_LIKELY(size > 0)) {
+            mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (HEDLEY_UNLIKELY(mapped == MAP_FAILED)) {
+                mapped = nullptr;
+                close(fd);
+                throw std::runtime_error("fail to map file");
+            }
+            // 资源包是从头到尾顺序读取的
+            madvise(mapped, size, MADV_SEQUENTIAL);
+            data = static_cast<const char *>(mapped);
+        }
+        // 关闭文件描述符不会影响已经映射的内存
+        close(fd);
+#endif
+    }
+
+    MappedFile::~MappedFile() {
+#if !defined(_WIN32)
+        if (HEDLEY_LIKELY(mapped != nullptr)) {
+            munmap(mapped, size);
+        }
+#endif
+    }
+
+    const char *MappedFile::getData() const {
+        return data;
+    }
 
+    size_t MappedFile::getSize() const {
+        return size;
+    }
+#endif
 
-}// namespace CHelper
\ No newline at end of file
+}// namespace CHelper
@@ -46,7 +46,7 @@ namespace CHelper::JsonUtil {
             return std::move(result);
         }
         StringReader stringReader(input);
-        result.indexConvertList.push_back(stringReader.pos.index);
+        result.indexConvertList.push_back(stringReader.index);
         int32_t unicodeValue;
         std::u16string escapeSequence;
         while (true) {
@@ -62,15 +62,15 @@ namespace CHelper::JsonUtil {
             //正常字符
             if (HEDLEY_LIKELY(ch.value() != u'\\')) {
                 result.result.push_back(ch.value());
-                result.indexConvertList.push_back(stringReader.pos.index);
+                result.indexConvertList.push_back(stringReader.index);
                 continue;
             }
             //转义字符
             ch = stringReader.next();
             if (HEDLEY_UNLIKELY(!ch.has_value())) {
                 result.errorReason = ErrorReason::incomplete(
-                        stringReader.pos.index - 1,
-                        stringReader.pos.index,
+                        stringReader.index - 1,
+                        stringReader.index,
                         u"转义字符缺失后半部分");
             } else {
                 switch (ch.value()) {
@@ -83,15 +83,15 @@ namespace CHelper::JsonUtil {
                     case u'r':
                     case u't':
                         result.result.push_back(ch.value());
-                        result.indexConvertList.push_back(stringReader.pos.index);
+                        result.indexConvertList.push_back(stringReader.index);
                         break;
                     case u'u':
                         for (uint8_t i = 0; i < 4; ++i) {
                             ch = stringReader.next();
                             if (HEDLEY_UNLIKELY(!ch.has_value())) {
                                 result.errorReason = ErrorReason::contentError(
-                                        stringReader.pos.index - 2 - i,
-                                        stringReader.pos.index,
+                                        stringReader.index - 2 - i,
+                                        stringReader.index,
                                         fmt::format(u"字符串转义缺失后半部分 -> \\u{}", escapeSequence));
                                 break;
                             }
@@ -107,8 +107,8 @@ namespace CHelper::JsonUtil {
                                             return false;
                                         } else {
                                             result.errorReason = ErrorReason::incomplete(
-                                                    stringReader.pos.index - escapeSequence.length() - 1,
-                                                    stringReader.pos.index + 1,
+                                                    stringReader.index - escapeSequence.length() - 1,
+                                                    stringReader.index + 1,
                                                     fmt::format(u"字符串转义出现非法字符{} -> \\u{}", item, escapeSequence));
                                             return true;
                                         }
@@ -118,7 +118,7 @@ namespace CHelper::JsonUtil {
                         unicodeValue = std::stoi(utf8::utf16to8(escapeSequence), nullptr, 16);
                         if (HEDLEY_UNLIKELY(unicodeValue <= 0 || unicodeValue > 0x10FFFF)) {
                             result.errorReason = ErrorReason::contentError(
-                                    stringReader.pos.index - escapeSequence.length() - 1, stringReader.pos.index + 1,
+                                    stringReader.index - escapeSequence.length() - 1, stringReader.index + 1,
                                     fmt::format(u"字符串转义的Unicode值无效 -> \\u{}", escapeSequence));
                             break;
                         }
@@ -147,11 +147,11 @@ namespace CHelper::JsonUtil {
                             result.result.push_back(
                                     static_cast<char>(0x80u | (static_cast<uint32_t>(unicodeValue) & 0x3Fu)));
                         }
-                        result.indexConvertList.push_back(stringReader.pos.index);
+                        result.indexConvertList.push_back(stringReader.index);
                         break;
                     default:
                         result.errorReason = ErrorReason::contentError(
-                                stringReader.pos.index - 1, stringReader.pos.index + 1,
+                                stringReader.index - 1, stringReader.index + 1,
                                 fmt::format(u"未知的转义字符 -> \\{:c}", ch.value()));
                         break;
                 }
@@ -0,0 +1,73 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/util/LatencyHistogram.h>
+
+namespace CHelper {
+
+    void LatencyHistogram::record(uint64_t nanoseconds) {
+        buckets[getBucketIndex(nanoseconds)]++;
+        count++;
+        max = std::max(max, nanoseconds);
+    }
+
+    void LatencyHistogram::clear() {
+        buckets.fill(0);
+        count = 0;
+        max = 0;
+    }
+
+    size_t LatencyHistogram::getCount() const {
+        return count;
+    }
+
+    uint64_t LatencyHistogram::getPercentile(double percentile) const {
+        if (HEDLEY_UNLIKELY(count == 0)) {
+            return 0;
+        }
+        auto target = static_cast<size_t>(std::ceil(static_cast<double>(count) * percentile / 100.0));
+        target = std::clamp<size_t>(target, 1, count);
+        size_t sum = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            sum += buckets[i];
+            if (HEDLEY_UNLIKELY(sum >= target)) {
+                return std::min(getBucketUpperBound(i), max);
+            }
+        }
+        return max;
+    }
+
+    LatencySnapshot LatencyHistogram::getSnapshot() const {
+        LatencySnapshot result;
+        result.count = count;
+        result.p50 = getPercentile(50);
+        result.p99 = getPercentile(99);
+        result.max = max;
+        return result;
+    }
+
+    size_t LatencyHistogram::getBucketIndex(uint64_t value) {
+        if (HEDLEY_UNLIKELY(value < SUB_BUCKET_COUNT)) {
+            return static_cast<size_t>(value);
+        }
+        // 最高位的位置
+        size_t exponent = SUB_BUCKET_BITS;
+        while (exponent < 63 && (value >> (exponent + 1)) != 0) {
+            exponent++;
+        }
+        size_t subBucket = static_cast<size_t>(value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+        return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + subBucket;
+    }
+
+    uint64_t LatencyHistogram::getBucketUpperBound(size_t index) {
+        if (HEDLEY_UNLIKELY(index < SUB_BUCKET_COUNT)) {
+            return index;
+        }
+        size_t exponent = index / SUB_BUCKET_COUNT + SUB_BUCKET_BITS - 1;
+        uint64_t subBucket = index % SUB_BUCKET_COUNT;
+        // 最后一个桶的上界会溢出为0，减1后正好是最大值
+        return ((SUB_BUCKET_COUNT + subBucket + 1) << (exponent - SUB_BUCKET_BITS)) - 1;
+    }
+
+}// namespace CHelper
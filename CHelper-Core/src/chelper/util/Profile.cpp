@@ -7,7 +7,7 @@
 
 namespace CHelper::Profile {
 
-    std::vector<std::string> stack;
+    thread_local std::vector<std::string> stack;
 
     void pop() {
         if (stack.empty()) {
@@ -0,0 +1,38 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/util/StringPool.h>
+
+namespace CHelper {
+
+    uint32_t StringPool::intern(const std::u16string_view &str) {
+        auto it = indexes.find(str);
+        if (HEDLEY_LIKELY(it != indexes.end())) {
+            return it->second;
+        }
+        if (HEDLEY_UNLIKELY(strings.size() >= NONE)) {
+            throw std::runtime_error("too many strings in string pool");
+        }
+        auto index = static_cast<uint32_t>(strings.size());
+        const std::u16string &item = strings.emplace_back(str);
+        indexes.emplace(item, index);
+        return index;
+    }
+
+    uint32_t StringPool::intern(const std::optional<std::u16string> &str) {
+        if (HEDLEY_UNLIKELY(!str.has_value())) {
+            return NONE;
+        }
+        return intern(std::u16string_view(str.value()));
+    }
+
+    size_t StringPool::size() const {
+        return strings.size();
+    }
+
+    const std::deque<std::u16string> &StringPool::getStrings() const {
+        return strings;
+    }
+
+}// namespace CHelper
@@ -0,0 +1,155 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/util/Trace.h>
+
+#ifdef CHelperTrace
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+
+namespace CHelper::Trace {
+
+    /**
+     * 每个线程的环形缓冲区，只有导出记录的时候才会和其他线程竞争锁
+     */
+    struct ThreadBuffer {
+        std::mutex mutex;
+        size_t threadId;
+        std::vector<Event> events;
+        //下一个记录写入的位置
+        size_t next = 0;
+
+        explicit ThreadBuffer(size_t threadId)
+            : threadId(threadId) {}
+    };
+
+    static std::atomic<bool> enabled = false;
+    static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    //线程结束后缓冲区仍然保留，这样还可以导出这个线程的记录
+    static std::mutex buffersMutex;
+    static std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+    static ThreadBuffer &getThreadBuffer() {
+        thread_local std::shared_ptr<ThreadBuffer> threadBuffer = []() {
+            std::lock_guard<std::mutex> lock(buffersMutex);
+            auto result = std::make_shared<ThreadBuffer>(buffers.size() + 1);
+            buffers.push_back(result);
+            return result;
+        }();
+        return *threadBuffer;
+    }
+
+    void setEnabled(bool isEnabled) {
+        enabled.store(isEnabled, std::memory_order_relaxed);
+    }
+
+    bool isEnabled() {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    void record(const char *name, std::string args, int64_t start, int64_t end) {
+        ThreadBuffer &buffer = getThreadBuffer();
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        if (HEDLEY_UNLIKELY(buffer.events.size() < BUFFER_CAPACITY)) {
+            buffer.events.push_back({name, std::move(args), start, end});
+        } else {
+            buffer.events[buffer.next] = {name, std::move(args), start, end};
+        }
+        buffer.next = (buffer.next + 1) % BUFFER_CAPACITY;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (const auto &buffer: buffers) {
+            std::lock_guard<std::mutex> lock2(buffer->mutex);
+            buffer->events.clear();
+            buffer->next = 0;
+        }
+    }
+
+    static void writeJsonString(std::ostream &ostream, std::string_view str) {
+        ostream << '"';
+        for (char ch: str) {
+            switch (ch) {
+                case '"':
+                    ostream << "\\\"";
+                    break;
+                case '\\':
+                    ostream << "\\\\";
+                    break;
+                case '\n':
+                    ostream << "\\n";
+                    break;
+                case '\r':
+                    ostream << "\\r";
+                    break;
+                case '\t':
+                    ostream << "\\t";
+                    break;
+                default:
+                    if (HEDLEY_UNLIKELY(static_cast<unsigned char>(ch) < 0x20)) {
+                        ostream << fmt::format("\\u{:04x}", static_cast<int>(ch));
+                    } else {
+                        ostream << ch;
+                    }
+                    break;
+            }
+        }
+        ostream << '"';
+    }
+
+    void writeChromeTrace(std::ostream &ostream) {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        ostream << R"({"traceEvents":[)";
+        bool isFirst = true;
+        for (const auto &buffer: buffers) {
+            std::lock_guard<std::mutex> lock2(buffer->mutex);
+            // 缓冲区写满后，最早的记录在next的位置
+            size_t size = buffer->events.size();
+            size_t begin = size < BUFFER_CAPACITY ? 0 : buffer->next;
+            for (size_t i = 0; i < size; ++i) {
+                const Event &event = buffer->events[(begin + i) % size];
+                if (HEDLEY_LIKELY(!isFirst)) {
+                    ostream << ',';
+                }
+                isFirst = false;
+                // trace_event的时间单位为微秒
+                ostream << R"({"name":)";
+                writeJsonString(ostream, event.name);
+                ostream << fmt::format(R"(,"ph":"X","ts":{:.3f},"dur":{:.3f},"pid":1,"tid":{})",
+                                       static_cast<double>(event.start) / 1000.0,
+                                       static_cast<double>(event.end - event.start) / 1000.0,
+                                       buffer->threadId);
+                if (HEDLEY_UNLIKELY(!event.args.empty())) {
+                    ostream << R"(,"args":{"detail":)";
+                    writeJsonString(ostream, event.args);
+                    ostream << '}';
+                }
+                ostream << '}';
+            }
+        }
+        ostream << R"(],"displayTimeUnit":"ns"})";
+    }
+
+#ifndef CHELPER_NO_FILESYSTEM
+    void writeChromeTrace(const std::filesystem::path &path) {
+        Profile::push("writing chrome trace to file: {}", path.u16string());
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream ostream(path, std::ios::binary);
+        writeChromeTrace(ostream);
+        ostream.close();
+        Profile::pop();
+    }
+#endif
+
+}// namespace CHelper::Trace
+
+#endif
@@ -21,10 +21,8 @@ CHelperApp::CHelperApp(QWidget *parent)
 #else
     QFile file(QString(":/assets/release-experiment-").append(CPACK_VERSION_RELEASE).append(".cpack"));
     if (file.open(QIODevice::ReadOnly) && file.isReadable()) {
-        std::istringstream iss(file.readAll().toStdString());
-        core = CHelper::CHelperCore::create([&iss] {
-            return CHelper::CPack::createByBinary(iss);
-        });
+        auto bytes = std::make_shared<QByteArray>(file.readAll());
+        core = CHelper::CHelperCore::createByBinary(bytes->constData(), bytes->size(), bytes);
     }
 #endif
     if (HEDLEY_UNLIKELY(core == nullptr)) {
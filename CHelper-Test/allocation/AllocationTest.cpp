@@ -0,0 +1,97 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chelper/CHelperCore.h>
+#include <chelper/parser/Parser.h>
+
+#include "../src/TestUtil.h"
+
+// 统计内存分配次数，替换全局的operator new会影响整个程序，所以放在单独的测试程序中
+static std::atomic<size_t> allocationCount{0};
+
+void *operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    void *result = std::malloc(size == 0 ? 1 : size);
+    if (HEDLEY_UNLIKELY(result == nullptr)) {
+        throw std::bad_alloc();
+    }
+    return result;
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+/**
+ * 解析一条命令时每个字符允许的内存分配次数的上限
+ *
+ * 这个值是估计的，没有根据测量结果确定，只用来发现分配次数明显的增长。
+ * 子节点是否被逐层深拷贝由MakeChildNodes检查，那个测试的结果和资源包无关，是精确的。
+ */
+static constexpr size_t MAX_ALLOCATIONS_PER_CHAR = 256;
+
+/**
+ * 生成一条深度为depth的AST节点链
+ */
+static CHelper::ASTNode makeChain(const CHelper::LexerResult &lexerResult, size_t depth) {
+    CHelper::TokensView tokens(&lexerResult, 0, lexerResult.allTokens.size());
+    CHelper::ASTNode result = CHelper::ASTNode::simpleNode(nullptr, tokens);
+    for (size_t i = 1; i < depth; ++i) {
+        result = CHelper::ASTNode::andNode(nullptr, CHelper::ASTNode::makeChildNodes(std::move(result)), tokens);
+    }
+    return result;
+}
+
+/**
+ * 合并子节点时移动子节点，分配次数和子节点的大小无关
+ *
+ * 移动子节点时三种深度都只分配1次，改为使用初始化列表复制子节点后分别分配1、37、3997次
+ */
+TEST(AllocationTest, MakeChildNodes) {
+    std::u16string content = u"a b";
+    CHelper::LexerResult lexerResult = CHelper::Lexer::lex(content);
+    CHelper::TokensView tokens(&lexerResult, 0, lexerResult.allTokens.size());
+    std::vector<size_t> counts;
+    for (size_t depth: {1, 10, 1000}) {
+        CHelper::ASTNode child1 = makeChain(lexerResult, depth);
+        CHelper::ASTNode child2 = makeChain(lexerResult, depth);
+        size_t start = allocationCount.load(std::memory_order_relaxed);
+        CHelper::ASTNode astNode = CHelper::ASTNode::andNode(
+                nullptr, CHelper::ASTNode::makeChildNodes(std::move(child1), std::move(child2)), tokens);
+        counts.push_back(allocationCount.load(std::memory_order_relaxed) - start);
+        EXPECT_EQ(astNode.childNodes.size(), 2);
+    }
+    CHELPER_INFO("allocations when merging child nodes: {} {} {}", counts[0], counts[1], counts[2]);
+    EXPECT_EQ(counts[0], counts[1]);
+    EXPECT_EQ(counts[0], counts[2]);
+    // 只需要为子节点的列表分配一次
+    EXPECT_LE(counts[0], 1);
+}
+
+/**
+ * 统计解析MainTest中的命令时的内存分配次数
+ */
+TEST(AllocationTest, ParseCommand) {
+    std::unique_ptr<CHelper::CPack> cpack = CHelper::Test::createCPack();
+    ASSERT_NE(cpack, nullptr);
+    size_t total = 0;
+    for (const auto &command: CHelper::Test::getTestCommands()) {
+        size_t start = allocationCount.load(std::memory_order_relaxed);
+        {
+            CHelper::ASTNode astNode = CHelper::Parser::parse(command, cpack.get());
+        }
+        size_t count = allocationCount.load(std::memory_order_relaxed) - start;
+        total += count;
+        CHELPER_INFO("{} allocations: {}", count, utf8::utf16to8(command));
+        EXPECT_LE(count, MAX_ALLOCATIONS_PER_CHAR * (command.size() + 1)) << utf8::utf16to8(command);
+    }
+    CHELPER_INFO("total allocations: {}", total);
+}
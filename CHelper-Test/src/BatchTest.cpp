@@ -0,0 +1,50 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <gtest/gtest.h>
+
+#include <chelper/parser/Batch.h>
+#include <chelper/parser/Parser.h>
+
+#include "TestUtil.h"
+
+TEST(BatchTest, SplitLines) {
+    std::vector<std::u16string_view> expected = {u"a", u"", u"b c", u""};
+    EXPECT_EQ(CHelper::Batch::splitLines(u"a\n\r\nb c\r\n"), expected);
+    EXPECT_EQ(CHelper::Batch::splitLines(u""), std::vector<std::u16string_view>{u""});
+}
+
+/**
+ * 批量检查的结果需要和逐行解析的结果相同，并且顺序不变
+ */
+TEST(BatchTest, Validate) {
+    std::unique_ptr<CHelper::CPack> cpack = CHelper::Test::createCPack();
+    ASSERT_NE(cpack, nullptr);
+    std::u16string content;
+    for (size_t i = 0; i < 20; ++i) {
+        content.append(u"# comment\n\n");
+        for (const auto &command: CHelper::Test::getTestCommands()) {
+            content.append(command).push_back(u'\n');
+        }
+    }
+    std::vector<std::u16string_view> lines = CHelper::Batch::splitLines(content);
+    for (size_t threads: {1, 4}) {
+        auto result = CHelper::Batch::validate(*cpack, lines, threads);
+        ASSERT_EQ(result.size(), lines.size());
+        for (size_t i = 0; i < lines.size(); ++i) {
+            if (lines[i].empty() || lines[i][0] == u'#') {
+                EXPECT_TRUE(result[i].empty());
+                continue;
+            }
+            auto errorReasons = CHelper::Parser::parse(std::u16string(lines[i]), cpack.get()).getErrorReasons();
+            ASSERT_EQ(result[i].size(), errorReasons.size());
+            for (size_t j = 0; j < errorReasons.size(); ++j) {
+                EXPECT_EQ(result[i][j]->level, errorReasons[j]->level);
+                EXPECT_EQ(result[i][j]->start, errorReasons[j]->start);
+                EXPECT_EQ(result[i][j]->end, errorReasons[j]->end);
+                EXPECT_EQ(result[i][j]->errorReason, errorReasons[j]->errorReason);
+            }
+        }
+    }
+}
@@ -6,7 +6,11 @@
 #include <chelper/node/template/NodeTemplateBoolean.h>
 #include <chelper/node/template/NodeTemplateNumber.h>
 #include <chelper/resources/CPack.h>
+#include <chelper/resources/id/IdStringTable.h>
 #include <gtest/gtest.h>
+#include <unordered_set>
+
+#include "TestUtil.h"
 
 namespace std {
 
@@ -424,6 +428,142 @@ TEST(BinaryUtilTest, CPackNamespaceId) {
             [&cpack]() { return cpack->namespaceIds; });
 }
 
+/**
+ * 普通ID和命名空间ID使用字符串表写入二进制资源包，读取后的内容需要和原来的相同
+ */
+TEST(BinaryUtilTest, CPackIdStringTable) {
+    std::unique_ptr<CHelper::CPack> cpack = CHelper::Test::createCPack();
+    ASSERT_NE(cpack, nullptr);
+    std::ostringstream oss;
+    CHelper::IdStringTable::toBinary(oss, cpack->normalIds, cpack->namespaceIds);
+    std::istringstream iss(oss.str());
+    CHelper::IdStringTable::NormalIds normalIds;
+    CHelper::IdStringTable::NamespaceIds namespaceIds;
+    CHelper::IdStringTable::fromBinary(iss, normalIds, namespaceIds);
+    EXPECT_EQ(cpack->normalIds, normalIds);
+    EXPECT_EQ(cpack->namespaceIds, namespaceIds);
+    EXPECT_EQ(iss.peek(), std::istringstream::traits_type::eof());
+}
+
+/**
+ * 不完整或者数量被改坏的字符串表需要抛出异常，不能读取未初始化的编号，也不能按照文件中的数量分配内存
+ */
+TEST(BinaryUtilTest, CorruptedIdStringTable) {
+    std::unique_ptr<CHelper::CPack> cpack = CHelper::Test::createCPack();
+    ASSERT_NE(cpack, nullptr);
+    std::ostringstream oss;
+    CHelper::IdStringTable::toBinary(oss, cpack->normalIds, cpack->namespaceIds);
+    std::string data = oss.str();
+    ASSERT_GT(data.size(), 4);
+    auto read = [](const std::string &content, size_t size) {
+        CHelper::MemoryStreamBuffer buffer(content.data(), size);
+        std::istream istream(&buffer);
+        CHelper::IdStringTable::NormalIds normalIds;
+        CHelper::IdStringTable::NamespaceIds namespaceIds;
+        CHelper::IdStringTable::fromBinary(istream, normalIds, namespaceIds);
+    };
+    EXPECT_NO_THROW(read(data, data.size()));
+    // 在不同的位置截断
+    for (size_t size: {size_t(0), size_t(2), data.size() / 2, data.size() - 1}) {
+        EXPECT_THROW(read(data, size), std::runtime_error) << "size " << size;
+        CHelper::Profile::clear();
+    }
+    // 字符串的数量远大于剩余的内容
+    std::string wrongCount = data;
+    wrongCount[0] = wrongCount[1] = wrongCount[2] = wrongCount[3] = static_cast<char>(0xFF);
+    EXPECT_THROW(read(wrongCount, wrongCount.size()), std::runtime_error);
+    CHelper::Profile::clear();
+}
+
+TEST(BinaryUtilTest, CPackFormatHeader) {
+    std::unique_ptr<CHelper::CPack> cpack = CHelper::Test::createCPack();
+    ASSERT_NE(cpack, nullptr);
+    std::string data = CHelper::Test::writeBinary(*cpack, "chelper-format-header-test.cpack");
+    ASSERT_GT(data.size(), 8);
+    EXPECT_NO_THROW(CHelper::CPack::createByBinary(data.data(), data.size()));
+    // 开头的标识不同
+    std::string wrongMagic = data;
+    wrongMagic[0] ^= 1;
+    EXPECT_THROW(CHelper::CPack::createByBinary(wrongMagic.data(), wrongMagic.size()), std::runtime_error);
+    CHelper::Profile::clear();
+    // 格式版本不同
+    std::string wrongVersion = data;
+    wrongVersion[4] ^= 1;
+    EXPECT_THROW(CHelper::CPack::createByBinary(wrongVersion.data(), wrongVersion.size()), std::runtime_error);
+    CHelper::Profile::clear();
+    // 文件不完整
+    EXPECT_THROW(CHelper::CPack::createByBinary(data.data(), 2), std::runtime_error);
+    CHelper::Profile::clear();
+}
+
+TEST(BinaryUtilTest, TruncatedCPack) {
+    std::unique_ptr<CHelper::CPack> cpack = CHelper::Test::createCPack();
+    ASSERT_NE(cpack, nullptr);
+    auto data = std::make_shared<std::string>(CHelper::Test::writeBinary(*cpack, "chelper-truncated-test.cpack"));
+    // 最后一条命令的内容会被延迟加载，少一个字节时它的长度会超出剩余的内容
+    EXPECT_THROW(CHelper::CPack::createByBinary(data->data(), data->size() - 1, data), std::runtime_error);
+    CHelper::Profile::clear();
+}
+
+/**
+ * 从内存中读取二进制资源包时，ID、ID列表的名字集合、JSON数据和重复部分在第一次使用时才读取，读取后的内容需要和原来的相同
+ */
+TEST(BinaryUtilTest, LazyCPackSections) {
+    std::unique_ptr<CHelper::CPack> cpack = CHelper::Test::createCPack();
+    ASSERT_NE(cpack, nullptr);
+    auto data = std::make_shared<std::string>(CHelper::Test::writeBinary(*cpack, "chelper-lazy-sections-test.cpack"));
+    std::unique_ptr<CHelper::CPack> lazyCPack;
+    try {
+        lazyCPack = CHelper::CPack::createByBinary(data->data(), data->size(), data);
+    } catch (const std::exception &e) {
+        CHelper::Profile::printAndClear(e);
+        FAIL();
+    }
+    // 加载资源包时只记录了位置
+    EXPECT_TRUE(lazyCPack->normalIds.empty());
+    EXPECT_TRUE(lazyCPack->namespaceIds.empty());
+    EXPECT_TRUE(lazyCPack->blockIds == nullptr);
+    EXPECT_TRUE(lazyCPack->itemIds == nullptr);
+    EXPECT_TRUE(lazyCPack->jsonNodes.empty());
+    EXPECT_TRUE(lazyCPack->repeatNodeData.empty());
+    // 第一次使用时读取
+    EXPECT_NE(lazyCPack->getNamespaceId(u"blocks"), nullptr);
+    EXPECT_NE(lazyCPack->getNamespaceIdIndex(u"items"), nullptr);
+    EXPECT_NE(lazyCPack->getJsonNode(u"components"), nullptr);
+    EXPECT_NE(lazyCPack->getRepeatNode(u"execute").first, nullptr);
+    lazyCPack->loadSections();
+    EXPECT_EQ(lazyCPack->normalIds, cpack->normalIds);
+    EXPECT_EQ(lazyCPack->namespaceIds, cpack->namespaceIds);
+    // 读取后再写入的内容和原来的相同
+    EXPECT_EQ(CHelper::Test::writeBinary(*lazyCPack, "chelper-lazy-sections-test.cpack"), *data);
+    EXPECT_TRUE(CHelper::Profile::stack.empty());
+}
+
+/**
+ * 方块状态相同的方块共用方块状态节点，最大附加值和附加值介绍相同的物品共用物品附加值节点
+ */
+TEST(BinaryUtilTest, SharedIdNodes) {
+    std::unique_ptr<CHelper::CPack> cpack = CHelper::Test::createCPack();
+    ASSERT_NE(cpack, nullptr);
+    auto blockIds = cpack->getBlockIds();
+    ASSERT_NE(blockIds, nullptr);
+    std::unordered_set<const CHelper::Node::NodeBase *> blockStateNodes;
+    for (const auto &item: *blockIds->blockStateValues) {
+        ASSERT_NE(item->getNode(), nullptr);
+        blockStateNodes.insert(item->getNode().get());
+    }
+    EXPECT_LT(blockStateNodes.size(), blockIds->blockStateValues->size());
+    auto itemIds = cpack->getItemIds();
+    ASSERT_NE(itemIds, nullptr);
+    std::map<std::pair<std::optional<int32_t>, std::optional<std::vector<std::u16string>>>, const CHelper::Node::NodeBase *> itemDataNodes;
+    for (const auto &item: *itemIds) {
+        ASSERT_NE(item->getNode(), nullptr);
+        const auto &node = itemDataNodes.emplace(std::make_pair(item->max, item->descriptions), item->getNode().get()).first->second;
+        EXPECT_EQ(node, item->getNode().get());
+    }
+    EXPECT_TRUE(CHelper::Profile::stack.empty());
+}
+
 TEST(BinaryUtilTest, NodeJsonBoolean) {
     std::unique_ptr<CHelper::CPack> cpack;
     std::filesystem::path resourceDir(RESOURCE_DIR);
@@ -0,0 +1,38 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <gtest/gtest.h>
+
+#include <chelper/parser/CommandGenerator.h>
+#include <chelper/parser/Parser.h>
+
+#include "TestUtil.h"
+
+/**
+ * 相同的随机种子生成的命令相同，生成的命令没有错误，修改后的命令和原来的命令不同
+ */
+TEST(CommandGeneratorTest, GenerateCommands) {
+    std::unique_ptr<CHelper::CPack> cpack = CHelper::Test::createCPack();
+    ASSERT_NE(cpack, nullptr);
+    CHelper::GeneratedCommands commands1 = CHelper::generateCommands(*cpack, 500, 500, 1);
+    CHelper::GeneratedCommands commands2 = CHelper::generateCommands(*cpack, 500, 500, 1);
+    EXPECT_EQ(commands1.valid, commands2.valid);
+    EXPECT_EQ(commands1.nearValid, commands2.nearValid);
+    // 连续多次生成失败时命令数量会少于要求的数量
+    EXPECT_FALSE(commands1.valid.empty());
+    EXPECT_FALSE(commands1.nearValid.empty());
+    for (const auto &command: commands1.valid) {
+        EXPECT_TRUE(CHelper::Parser::parse(command, cpack.get()).getErrorReasons().empty())
+                << utf8::utf16to8(command);
+    }
+    CHelper::GeneratedCommands commands3 = CHelper::generateCommands(*cpack, 500, 0, 2);
+    EXPECT_NE(commands1.valid, commands3.valid);
+    // 修改后的命令仍然可以正常解析
+    for (const auto &command: commands1.nearValid) {
+        CHelper::ASTNode astNode = CHelper::Parser::parse(command, cpack.get());
+        astNode.getErrorReasons();
+        astNode.getSuggestions(command.length());
+        astNode.getStructure();
+    }
+}
@@ -0,0 +1,116 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <gtest/gtest.h>
+
+#include <chelper/CHelperCore.h>
+#include <chelper/parser/Parser.h>
+#include <thread>
+
+#include "TestUtil.h"
+
+namespace CHelper::Test {
+
+    /**
+     * 单个命令的解析结果，用于比较不同线程的解析结果是否相同
+     */
+    struct ParseResult {
+        std::u16string structure;
+        std::u16string description;
+        size_t errorReasonCount;
+        std::vector<std::u16string> suggestions;
+
+        bool operator==(const ParseResult &other) const {
+            return structure == other.structure &&
+                   description == other.description &&
+                   errorReasonCount == other.errorReasonCount &&
+                   suggestions == other.suggestions;
+        }
+    };
+
+    static ParseResult getParseResult(const std::u16string &command, const CPack *cpack) {
+        ASTNode astNode = Parser::parse(command, cpack);
+        ParseResult result;
+        result.structure = astNode.getStructure();
+        result.description = astNode.getDescription(command.length());
+        result.errorReasonCount = astNode.getErrorReasons().size();
+        for (const auto &item: astNode.getSuggestions(command.length())) {
+            result.suggestions.push_back(item.content->name);
+        }
+        return result;
+    }
+
+}// namespace CHelper::Test
+
+/**
+ * 多个线程同时使用同一个资源包解析命令，解析结果需要和单线程解析的结果相同
+ *
+ * 共享的资源包从内存中的二进制资源包创建，命令的节点、ID、JSON数据和ID列表的搜索索引都会在多个线程中同时延迟加载
+ */
+TEST(ConcurrencyTest, SharedCPack) {
+    std::vector<std::u16string> commands = CHelper::Test::getTestCommands();
+    std::unique_ptr<CHelper::CPack> cpack = CHelper::Test::createCPack();
+    ASSERT_NE(cpack, nullptr);
+    std::unique_ptr<CHelper::CPack> sharedCPack;
+    try {
+        auto data = std::make_shared<std::string>(CHelper::Test::writeBinary(*cpack, "chelper-concurrency-test.cpack"));
+        sharedCPack = CHelper::CPack::createByBinary(data->data(), data->size(), data);
+    } catch (const std::exception &e) {
+        CHelper::Profile::printAndClear(e);
+        FAIL();
+    }
+    std::vector<CHelper::Test::ParseResult> expected;
+    expected.reserve(commands.size());
+    for (const auto &command: commands) {
+        expected.push_back(CHelper::Test::getParseResult(command, cpack.get()));
+    }
+    size_t threadCount = std::max<size_t>(4, std::thread::hardware_concurrency());
+    std::vector<std::thread> threads;
+    std::vector<size_t> mismatchCounts(threadCount, 0);
+    std::vector<size_t> exceptionCounts(threadCount, 0);
+    threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&, i]() {
+            for (size_t round = 0; round < 20; ++round) {
+                // 每个线程从不同的位置开始，让同一时刻解析的命令尽量不同
+                for (size_t j = 0; j < commands.size(); ++j) {
+                    size_t index = (i * 7 + j + round) % commands.size();
+                    try {
+                        if (!(CHelper::Test::getParseResult(commands[index], sharedCPack.get()) == expected[index])) {
+                            mismatchCounts[i]++;
+                        }
+                    } catch (const std::exception &e) {
+                        CHelper::Profile::printAndClear(e);
+                        exceptionCounts[i]++;
+                    }
+                }
+            }
+            // 每个线程有自己的Profile栈，解析完成后应该是空的
+            EXPECT_TRUE(CHelper::Profile::stack.empty());
+        });
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+    for (size_t i = 0; i < threadCount; ++i) {
+        EXPECT_EQ(mismatchCounts[i], 0) << "thread " << i;
+        EXPECT_EQ(exceptionCounts[i], 0) << "thread " << i;
+    }
+}
+
+/**
+ * 从文件夹读取资源包时会在多个线程中同时读取文件和初始化节点，每次读取的结果都需要相同
+ */
+TEST(ConcurrencyTest, ParallelDirectoryLoad) {
+    std::vector<std::string> binaries;
+    for (size_t i = 0; i < 3; ++i) {
+        std::unique_ptr<CHelper::CPack> cpack = CHelper::Test::createCPack();
+        ASSERT_NE(cpack, nullptr);
+        binaries.push_back(CHelper::Test::writeBinary(*cpack, "chelper-parallel-load-test.cpack"));
+        EXPECT_TRUE(CHelper::Profile::stack.empty());
+    }
+    for (size_t i = 1; i < binaries.size(); ++i) {
+        EXPECT_EQ(binaries[i], binaries[0]) << "load " << i;
+    }
+}
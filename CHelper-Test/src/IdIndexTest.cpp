@@ -0,0 +1,95 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/resources/id/IdIndex.h>
+#include <chelper/util/KMPMatcher.h>
+#include <gtest/gtest.h>
+#include <random>
+
+static std::u16string randomString(std::mt19937 &random, size_t maxLength) {
+    const std::u16string chars = u"abc_:.";
+    std::u16string result;
+    size_t length = random() % (maxLength + 1);
+    for (size_t i = 0; i < length; ++i) {
+        result.push_back(chars[random() % chars.length()]);
+    }
+    return result;
+}
+
+TEST(IdIndexTest, NormalId) {
+    std::mt19937 random(20241215);
+    auto contentsPtr = std::make_shared<std::vector<std::shared_ptr<CHelper::NormalId>>>();
+    auto &contents = *contentsPtr;
+    for (size_t i = 0; i < 300; ++i) {
+        contents.push_back(CHelper::NormalId::make(
+                randomString(random, 8),
+                random() % 3 == 0 ? std::nullopt : std::make_optional(randomString(random, 12))));
+    }
+    CHelper::NormalIdIndex index(contentsPtr);
+    for (size_t i = 0; i < 1000; ++i) {
+        std::u16string str = randomString(random, 4);
+        CHelper::KMPMatcher kmpMatcher(str);
+        std::vector<uint32_t> nameStartOf, nameContain, descriptionContain;
+        for (uint32_t j = 0; j < contents.size(); ++j) {
+            const auto &item = contents[j];
+            size_t index1 = kmpMatcher.match(item->name);
+            if (index1 != std::u16string::npos) {
+                (index1 == 0 ? nameStartOf : nameContain).push_back(j);
+                continue;
+            }
+            if (item->description.has_value() && kmpMatcher.match(item->description.value()) != std::u16string::npos) {
+                descriptionContain.push_back(j);
+            }
+        }
+        std::vector<uint32_t> nameStartOf1, nameContain1, descriptionContain1;
+        index.search(str, nameStartOf1, nameContain1, descriptionContain1);
+        EXPECT_EQ(nameStartOf, nameStartOf1);
+        EXPECT_EQ(nameContain, nameContain1);
+        EXPECT_EQ(descriptionContain, descriptionContain1);
+    }
+}
+
+TEST(IdIndexTest, NamespaceId) {
+    std::mt19937 random(20241215);
+    auto contentsPtr = std::make_shared<std::vector<std::shared_ptr<CHelper::NamespaceId>>>();
+    auto &contents = *contentsPtr;
+    const std::vector<std::optional<std::u16string>> namespaces = {std::nullopt, u"minecraft", u"abc"};
+    for (size_t i = 0; i < 300; ++i) {
+        auto item = std::make_shared<CHelper::NamespaceId>();
+        item->name = randomString(random, 8);
+        item->description = random() % 3 == 0 ? std::nullopt : std::make_optional(randomString(random, 12));
+        item->idNamespace = namespaces[random() % namespaces.size()];
+        contents.push_back(std::move(item));
+    }
+    CHelper::NamespaceIdIndex index(contentsPtr);
+    for (size_t i = 0; i < 1000; ++i) {
+        std::u16string str = randomString(random, 4);
+        CHelper::KMPMatcher kmpMatcher(str);
+        std::vector<uint32_t> nameStartOf, nameContain, namespaceStartOf, namespaceContain, descriptionContain;
+        for (uint32_t j = 0; j < contents.size(); ++j) {
+            const auto &item = contents[j];
+            if (!item->idNamespace.has_value() || item->idNamespace.value() == u"minecraft") {
+                size_t index1 = kmpMatcher.match(item->name);
+                if (index1 != std::u16string::npos) {
+                    (index1 == 0 ? nameStartOf : nameContain).push_back(j);
+                }
+            }
+            size_t index1 = kmpMatcher.match(item->getIdWithNamespace()->name);
+            if (index1 != std::u16string::npos) {
+                (index1 == 0 ? namespaceStartOf : namespaceContain).push_back(j);
+                continue;
+            }
+            if (item->description.has_value() && kmpMatcher.match(item->description.value()) != std::u16string::npos) {
+                descriptionContain.push_back(j);
+            }
+        }
+        std::vector<uint32_t> nameStartOf1, nameContain1, namespaceStartOf1, namespaceContain1, descriptionContain1;
+        index.search(str, nameStartOf1, nameContain1, namespaceStartOf1, namespaceContain1, descriptionContain1);
+        EXPECT_EQ(nameStartOf, nameStartOf1);
+        EXPECT_EQ(nameContain, nameContain1);
+        EXPECT_EQ(namespaceStartOf, namespaceStartOf1);
+        EXPECT_EQ(namespaceContain, namespaceContain1);
+        EXPECT_EQ(descriptionContain, descriptionContain1);
+    }
+}
@@ -0,0 +1,35 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/resources/id/IdSet.h>
+#include <gtest/gtest.h>
+
+TEST(IdSetTest, NamespaceId) {
+    std::vector<std::shared_ptr<CHelper::NamespaceId>> contents;
+    for (size_t i = 0; i < 1000; ++i) {
+        auto item = std::make_shared<CHelper::NamespaceId>();
+        item->name = u"id" + std::u16string(i % 10 + 1, u'_') + fmt::format(u"{}", i);
+        if (i % 3 == 0) {
+            item->idNamespace = u"abc";
+        }
+        contents.push_back(std::move(item));
+    }
+    CHelper::IdSet idSet(contents);
+    for (const auto &item: contents) {
+        EXPECT_TRUE(idSet.contains(item->name));
+        EXPECT_TRUE(idSet.contains(item->getIdWithNamespace()->name));
+        EXPECT_FALSE(idSet.contains(item->name + u"x"));
+    }
+    EXPECT_FALSE(idSet.contains(u""));
+    EXPECT_FALSE(CHelper::IdSet().contains(u"id"));
+}
+
+TEST(IdSetTest, FullTable) {
+    // 损坏的资源包中可能读取到没有空位置的集合
+    CHelper::IdSet idSet;
+    idSet.slots.assign(8, 1);
+    idSet.slots[3] = CHelper::IdSet::hash(u"id");
+    EXPECT_TRUE(idSet.contains(u"id"));
+    EXPECT_FALSE(idSet.contains(u"other"));
+}
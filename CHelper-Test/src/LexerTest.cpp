@@ -0,0 +1,222 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <chelper/lexer/Lexer.h>
+#include <chelper/node/util/NodeAnd.h>
+#include <chelper/node/util/NodeSingleSymbol.h>
+#include <gtest/gtest.h>
+#include <random>
+
+#include "TestUtil.h"
+
+namespace {
+
+    /**
+     * 改为查表之前逐个字符判断的词法分析器，用于检查现在的实现得到的结果是否相同
+     */
+    namespace ReferenceLexer {
+
+        //字符串的结束字符
+        const std::u16string endChars = u" ,@~^/$&\"'!#%+*=[{]}\\|<>`\n";
+        //可以被识别成符号的字符，这些字符不一定是字符串的结束字符
+        const std::u16string symbols = u",@~^/$&'!#%+*=[{]}\\|<>`+-=:";
+
+        class ReferenceToken {
+        public:
+            CHelper::TokenType::TokenType type;
+            size_t index;
+            size_t length;
+        };
+
+        bool isNum(char16_t ch) {
+            return (ch >= '0' && ch <= '9') || ch == '.';
+        }
+
+        std::vector<ReferenceToken> lex(const std::u16string &content) {
+            std::vector<ReferenceToken> result;
+            size_t index = 0;
+            while (index < content.length()) {
+                size_t start = index;
+                char16_t ch = content[index];
+                CHelper::TokenType::TokenType type;
+                if (ch == '\n') {
+                    type = CHelper::TokenType::LF;
+                    index++;
+                } else if (ch == ' ') {
+                    type = CHelper::TokenType::WHITE_SPACE;
+                    index++;
+                } else if (isNum(ch) || ((ch == '+' || ch == '-') && index + 1 < content.length() && isNum(content[index + 1]))) {
+                    type = CHelper::TokenType::NUMBER;
+                    while (index < content.length() && (isNum(content[index]) || content[index] == '+' || content[index] == '-')) {
+                        index++;
+                    }
+                } else if (symbols.find(ch) != std::u16string::npos) {
+                    type = CHelper::TokenType::SYMBOL;
+                    index++;
+                } else {
+                    type = CHelper::TokenType::STRING;
+                    bool isDoubleQuotation = ch == '"';
+                    if (isDoubleQuotation) {
+                        index++;
+                    }
+                    while (index < content.length()) {
+                        ch = content[index];
+                        if (ch == '\\') {
+                            //转义字符
+                            index++;
+                            if (index >= content.length()) {
+                                break;
+                            }
+                        } else if (isDoubleQuotation) {
+                            //如果是双引号开头，只能使用双引号结尾
+                            if (ch == '"') {
+                                index++;
+                                break;
+                            }
+                        } else if (endChars.find(ch) != std::u16string::npos) {
+                            break;
+                        }
+                        index++;
+                    }
+                }
+                //之前每个空格是一个token，现在连续的空格合并为一个token
+                if (type == CHelper::TokenType::WHITE_SPACE && !result.empty() && result.back().type == CHelper::TokenType::WHITE_SPACE) {
+                    result.back().length += index - start;
+                    continue;
+                }
+                result.push_back({type, start, index - start});
+            }
+            return result;
+        }
+
+    }// namespace ReferenceLexer
+
+}// namespace
+
+void checkLexerResult(const CHelper::LexerResult &lexerResult1, const CHelper::LexerResult &lexerResult2) {
+    EXPECT_EQ(lexerResult1.content, lexerResult2.content);
+    ASSERT_EQ(lexerResult1.allTokens.size(), lexerResult2.allTokens.size());
+    for (size_t i = 0; i < lexerResult1.allTokens.size(); ++i) {
+        const CHelper::Token &token1 = lexerResult1.allTokens[i];
+        const CHelper::Token &token2 = lexerResult2.allTokens[i];
+        EXPECT_EQ(token1.type, token2.type);
+        EXPECT_EQ(token1.index, token2.index);
+        EXPECT_EQ(token1.content, token2.content);
+    }
+}
+
+TEST(LexerTest, Relex) {
+    const std::u16string chars = u"abc0123.+-~^@[]{}=,:\\\"' \n";
+    std::mt19937 random(20241214);
+    std::u16string content = u"execute as @a[r=10] at @s run tp ~ ~1.5 ~-2\ngive @s stone 1 0 {\"a\":\"b c\"}";
+    std::unique_ptr<CHelper::LexerResult> old = std::make_unique<CHelper::LexerResult>(CHelper::Lexer::lex(content));
+    for (size_t i = 0; i < 10000; ++i) {
+        size_t start = random() % (content.length() + 1);
+        size_t removeLength = std::min<size_t>(random() % 4, content.length() - start);
+        size_t insertLength = content.length() > 200 ? 0 : random() % 4;
+        std::u16string newContent = content;
+        std::u16string insert;
+        for (size_t j = 0; j < insertLength; ++j) {
+            insert.push_back(chars[random() % chars.length()]);
+        }
+        newContent.replace(start, removeLength, insert);
+        CHelper::LexerResult expected = CHelper::Lexer::lex(newContent);
+        checkLexerResult(expected, CHelper::Lexer::relex(*old, newContent));
+        std::unique_ptr<CHelper::LexerResult> current = std::make_unique<CHelper::LexerResult>(
+                CHelper::Lexer::relex(*old, newContent, {start, removeLength, insertLength}));
+        checkLexerResult(expected, *current);
+        content = std::move(newContent);
+        old = std::move(current);
+    }
+}
+
+/**
+ * 连续的空格合并为一个token，换行不会和空格合并
+ */
+TEST(LexerTest, WhiteSpaceRun) {
+    std::u16string content = u"tp   @s\n  ~ \"a  b\"";
+    CHelper::LexerResult lexerResult = CHelper::Lexer::lex(content);
+    std::vector<std::pair<CHelper::TokenType::TokenType, std::u16string_view>> expected = {
+            {CHelper::TokenType::STRING, u"tp"},
+            {CHelper::TokenType::WHITE_SPACE, u"   "},
+            {CHelper::TokenType::SYMBOL, u"@"},
+            {CHelper::TokenType::STRING, u"s"},
+            {CHelper::TokenType::LF, u"\n"},
+            {CHelper::TokenType::WHITE_SPACE, u"  "},
+            {CHelper::TokenType::SYMBOL, u"~"},
+            {CHelper::TokenType::WHITE_SPACE, u" "},
+            {CHelper::TokenType::STRING, u"\"a  b\""}};
+    ASSERT_EQ(lexerResult.allTokens.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(lexerResult.allTokens[i].type, expected[i].first);
+        EXPECT_EQ(lexerResult.allTokens[i].content, expected[i].second);
+    }
+    EXPECT_EQ(lexerResult.getPos(lexerResult.allTokens[5].index).line, 1);
+    EXPECT_EQ(lexerResult.getPos(lexerResult.allTokens[6].index).col, 3);
+    EXPECT_EQ(CHelper::Lexer::lex(std::u16string(10000, u' ')).allTokens.size(), 1);
+}
+
+/**
+ * 通过换行符的位置计算的行号和列号需要和逐个字符计算的结果相同
+ */
+TEST(LexerTest, LineColumn) {
+    std::u16string content = u"\nexecute as @a\n\nrun say \"a\nb\"\n";
+    CHelper::LexerResult lexerResult = CHelper::Lexer::lex(content);
+    size_t line = 0, col = 0;
+    for (size_t i = 0; i <= content.length(); ++i) {
+        CHelper::LexerPos pos = lexerResult.getPos(i);
+        EXPECT_EQ(pos.index, i);
+        EXPECT_EQ(pos.line, line) << "index " << i;
+        EXPECT_EQ(pos.col, col) << "index " << i;
+        if (i < content.length() && content[i] == u'\n') {
+            line++;
+            col = 1;
+        } else {
+            col++;
+        }
+    }
+}
+
+/**
+ * 随机生成内容，和之前逐个字符判断的词法分析器比较结果
+ */
+TEST(LexerTest, CompareWithReference) {
+    const std::u16string chars = u"abc0123.+-~^@[]{}=,:\\\"' \n\t中";
+    std::mt19937 random(20241215);
+    for (size_t i = 0; i < 200000; ++i) {
+        std::u16string content;
+        size_t length = random() % 30;
+        for (size_t j = 0; j < length; ++j) {
+            content.push_back(chars[random() % chars.length()]);
+        }
+        std::vector<ReferenceLexer::ReferenceToken> expected = ReferenceLexer::lex(content);
+        CHelper::LexerResult lexerResult = CHelper::Lexer::lex(content);
+        ASSERT_EQ(lexerResult.allTokens.size(), expected.size()) << utf8::utf16to8(content);
+        for (size_t j = 0; j < expected.size(); ++j) {
+            const CHelper::Token &token = lexerResult.allTokens[j];
+            ASSERT_EQ(token.type, expected[j].type) << utf8::utf16to8(content);
+            ASSERT_EQ(token.index, expected[j].index) << utf8::utf16to8(content);
+            ASSERT_EQ(token.content.data(), content.data() + expected[j].index) << utf8::utf16to8(content);
+            ASSERT_EQ(token.content.length(), expected[j].length) << utf8::utf16to8(content);
+        }
+    }
+}
+
+/**
+ * 不允许空格的地方出现连续的空格时，错误的范围是所有连续的空格
+ */
+TEST(LexerTest, UnexpectedWhiteSpaceRun) {
+    std::unique_ptr<CHelper::CPack> cpack = CHelper::Test::createCPack();
+    ASSERT_NE(cpack, nullptr);
+    CHelper::Node::NodeSingleSymbol left(u"LEFT", u"左括号", u'[');
+    CHelper::Node::NodeSingleSymbol right(u"RIGHT", u"右括号", u']');
+    CHelper::Node::NodeAnd node(u"TEST", u"测试", CHelper::Node::WhitespaceMode::NO_WHITESPACE, {&left, &right});
+    auto lexerResult = std::make_shared<CHelper::LexerResult>(CHelper::Lexer::lex(u"[   ]"));
+    CHelper::TokenReader tokenReader(lexerResult);
+    CHelper::ASTNode astNode = node.getASTNode(tokenReader, cpack.get());
+    ASSERT_EQ(astNode.errorReasons.size(), 1);
+    EXPECT_EQ(astNode.errorReasons[0]->errorReason, u"意外的空格");
+    EXPECT_EQ(astNode.errorReasons[0]->start, 1);
+    EXPECT_EQ(astNode.errorReasons[0]->end, 4);
+}
@@ -5,8 +5,11 @@
 #include <gtest/gtest.h>
 
 #include <chelper/CHelperCore.h>
+#include <chelper/parser/CursorIndex.h>
 #include <chelper/parser/Parser.h>
 
+#include "TestUtil.h"
+
 namespace CHelper::Test {
 
 #pragma warning(disable : 4068)
@@ -50,41 +53,204 @@ namespace CHelper::Test {
         }
     }
 
+    /**
+     * 测试增量解析的结果是否和完整解析的结果一致
+     */
+    [[maybe_unused]] void testIncremental(const std::filesystem::path &cpackPath,
+                                          const std::vector<std::u16string> &commands) {
+        std::unique_ptr<CPack> cPack = createCPack(cpackPath);
+        ASSERT_NE(cPack, nullptr);
+        ASTNode astNode0 = Parser::parse(u"", cPack.get());
+        auto core = std::make_shared<CHelperCore>(std::move(cPack), std::move(astNode0));
+        for (const auto &command: commands) {
+            // 模拟逐个字符输入，然后逐个字符删除
+            std::vector<std::u16string> inputs;
+            for (size_t i = 0; i <= command.length(); ++i) {
+                inputs.push_back(command.substr(0, i));
+            }
+            for (size_t i = command.length(); i > 0; --i) {
+                inputs.push_back(command.substr(0, i - 1));
+            }
+            for (const auto &input: inputs) {
+                core->onTextChanged(input, input.length());
+                ASTNode astNode = Parser::parse(input, core->getCPack());
+                EXPECT_EQ(core->getAstNode()->tokens.toString(), astNode.tokens.toString());
+                EXPECT_EQ(core->getStructure(), astNode.getStructure());
+                EXPECT_EQ(core->getDescription(), astNode.getDescription(input.length()));
+                std::vector<std::shared_ptr<ErrorReason>> errorReasons1 = core->getErrorReasons();
+                std::vector<std::shared_ptr<ErrorReason>> errorReasons2 = astNode.getErrorReasons();
+                EXPECT_EQ(errorReasons1.size(), errorReasons2.size());
+                for (size_t i = 0; i < std::min(errorReasons1.size(), errorReasons2.size()); ++i) {
+                    EXPECT_EQ(errorReasons1[i]->level, errorReasons2[i]->level);
+                    EXPECT_EQ(errorReasons1[i]->start, errorReasons2[i]->start);
+                    EXPECT_EQ(errorReasons1[i]->end, errorReasons2[i]->end);
+                    EXPECT_EQ(errorReasons1[i]->errorReason, errorReasons2[i]->errorReason);
+                }
+                EXPECT_EQ(core->getSuggestions()->size(), astNode.getSuggestions(input.length()).size());
+                EXPECT_EQ(core->getSuggestionCount(), core->getSuggestions()->size());
+                std::vector<Suggestion> page = core->getSuggestions(1, 3);
+                for (size_t i = 0; i < page.size(); ++i) {
+                    EXPECT_TRUE(page[i].equal(core->getSuggestions()->at(i + 1)));
+                }
+            }
+        }
+    }
+
+    /**
+     * 测试使用备忘录解析的结果是否和不使用备忘录解析的结果一致
+     */
+    [[maybe_unused]] void testParseMemo(const std::filesystem::path &cpackPath,
+                                        const std::vector<std::u16string> &commands) {
+        std::unique_ptr<CPack> cPack = createCPack(cpackPath);
+        ASSERT_NE(cPack, nullptr);
+        for (const auto &command: commands) {
+            ParseMemo parseMemo;
+            ASTNode astNode1 = Parser::parse(command, cPack.get());
+            ASTNode astNode2 = Parser::parse(command, cPack.get(), parseMemo);
+            EXPECT_EQ(astNode1.getStructure(), astNode2.getStructure());
+            EXPECT_EQ(astNode1.getDescription(command.length()), astNode2.getDescription(command.length()));
+            EXPECT_EQ(astNode1.getErrorReasons().size(), astNode2.getErrorReasons().size());
+            EXPECT_EQ(astNode1.getSuggestions(command.length()).size(), astNode2.getSuggestions(command.length()).size());
+        }
+    }
+
+    /**
+     * 测试使用光标索引获取的说明和补全提示是否和从根节点遍历得到的结果一致
+     */
+    [[maybe_unused]] void testCursorIndex(const std::filesystem::path &cpackPath,
+                                          const std::vector<std::u16string> &commands) {
+        std::unique_ptr<CPack> cPack = createCPack(cpackPath);
+        ASSERT_NE(cPack, nullptr);
+        for (const auto &command: commands) {
+            ASTNode astNode = Parser::parse(command, cPack.get());
+            CursorIndex cursorIndex(astNode);
+            for (size_t index = 0; index <= command.length(); ++index) {
+                EXPECT_EQ(astNode.getDescription(index), astNode.getDescription(index, &cursorIndex));
+                std::vector<Suggestion> suggestions1 = astNode.getSuggestions(index);
+                std::vector<Suggestion> suggestions2 = astNode.getSuggestions(index, &cursorIndex);
+                ASSERT_EQ(suggestions1.size(), suggestions2.size()) << utf8::utf16to8(command) << " " << index;
+                for (size_t i = 0; i < suggestions1.size(); ++i) {
+                    EXPECT_TRUE(suggestions1[i].equal(suggestions2[i]));
+                    EXPECT_EQ(suggestions1[i].start, suggestions2[i].start);
+                    EXPECT_EQ(suggestions1[i].end, suggestions2[i].end);
+                }
+            }
+        }
+    }
+
 #pragma clang diagnostic pop
 
 }// namespace CHelper::Test
 
 TEST(MainTest, ParseCommand) {
     std::filesystem::path resourceDir(RESOURCE_DIR);
-    CHelper::Test::test(
+    CHelper::Test::test(resourceDir / "resources" / "beta" / "vanilla",
+                        CHelper::Test::getTestCommands());
+}
+
+TEST(MainTest, IncrementalParse) {
+    std::filesystem::path resourceDir(RESOURCE_DIR);
+    CHelper::Test::testIncremental(
             resourceDir / "resources" / "beta" / "vanilla",
             std::vector<std::u16string>{
-                    uR"(execute run clear )",
-                    uR"(give @s[hasitem=[{item=air,data=1},{item=minecraft:bed}],has_property={minecraft:is_rolled_up=true,m)",
-                    uR"(give @s command_block 112 12 {"minecraft:can_place_on":{"blocks":[")",
-                    uR"(tellraw @a {"rawtext":[{"text":"aaa","selector":"@a[type=\")",
-                    uR"(execute if block 12~23~)",
-                    uR"(give @s stone 12 21 {"minecraft:item_lock":{"mode":"l)",
-                    uR"(execute if block ~~~ anvil["aaa"=90.5] run g)",
-                    uR"(setblock ~~~ stone[)",
-                    uR"(give @s stone 12 1)",
-                    uR"(tag @s add "\\\"\u1110\/\b\f\n\r\t\p\")",
+                    uR"(execute as @a[tag=test,r=10] at @s positioned ~ ~1 ~ if block ~~~ stone run tp @s ~ ~ ~)",
+                    uR"(give @s command_block 12 12 {"minecraft:can_destroy":{"blocks":["minecraft:acacia_door"]}})",
+                    uR"(execute if block ~~~ anvil["aaa"=90.5] run give @a[hasitem={item=apple}] stone 1 0)",
+                    uR"(tellraw @a {"rawtext":[{"text":"aaa","selector":"@a[type=\"zombie\"]"}]})",
+            });
+}
+
+TEST(MainTest, ParseMemo) {
+    std::filesystem::path resourceDir(RESOURCE_DIR);
+    CHelper::Test::testParseMemo(
+            resourceDir / "resources" / "beta" / "vanilla",
+            std::vector<std::u16string>{
+                    uR"(execute as @a[tag=test,r=10] at @s positioned ~ ~1 ~ if block ~~~ stone run tp @s ~ ~ ~)",
                     uR"(give @s command_block 12 12 {"minecraft:can_destroy":{"blocks":["minecraft:acacia_door"]}})",
-                    uR"(give @s s)",
-                    uR"(give @s stone 1 1 {)",
-                    uR"(give @s 石头)",
-                    uR"(give @s command_block 12 12 {"minecraft:can_destroy":{"blocks":[")",
-                    uR"(give)",
-                    uR"(give @)",
+                    uR"(execute if block ~~~ anvil["aaa"=90.5] run g)",
                     uR"(give @a[x=^,has_property={""=!..12,="..}})",
-                    uR"(execute as @a run)",
-                    uR"(execute run)",
-                    uR"(execute if block ~~~ command_block run)",
-                    uR"(execute if block ~~~ bamboo)",
-                    uR"(give @s apple 12 1)",
-                    uR"(spreadplayers ~ ~ 0 1200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000)",
-                    uR"(camerashake add @a 10000000000000000000000000000000000000000000000000000 3402823466385288598117041834845169254401)",
                     uR"(setblock ~~~ candle_cake[lit=)",
-                    uR"(give @s repeating_command_block)",
+                    uR"(tellraw @a {"rawtext":[{"text":"aaa","selector":"@a[type=\")",
             });
-}
\ No newline at end of file
+}
+
+TEST(MainTest, CursorIndex) {
+    std::filesystem::path resourceDir(RESOURCE_DIR);
+    CHelper::Test::testCursorIndex(resourceDir / "resources" / "beta" / "vanilla",
+                                   CHelper::Test::getTestCommands());
+}
+
+/**
+ * 只获取错误原因时会丢弃失败的分支，错误原因需要和完整解析的结果相同
+ */
+TEST(MainTest, Validate) {
+    std::unique_ptr<CHelper::CPack> cpack = CHelper::Test::createCPack();
+    ASSERT_NE(cpack, nullptr);
+    for (const auto &command: CHelper::Test::getTestCommands()) {
+        auto errorReasons1 = CHelper::Parser::parse(command, cpack.get()).getErrorReasons();
+        auto errorReasons2 = CHelper::Parser::validate(command, cpack.get());
+        ASSERT_EQ(errorReasons1.size(), errorReasons2.size()) << utf8::utf16to8(command);
+        for (size_t i = 0; i < errorReasons1.size(); ++i) {
+            EXPECT_EQ(*errorReasons1[i], *errorReasons2[i]) << utf8::utf16to8(command);
+        }
+    }
+}
+
+/**
+ * 内容、光标位置和主题没有改变时返回上一次计算的结果，改变后重新计算
+ */
+TEST(MainTest, CachedOutputs) {
+    std::unique_ptr<CHelper::CHelperCore> core(CHelper::CHelperCore::create([]() {
+        return CHelper::Test::createCPack();
+    }));
+    ASSERT_NE(core, nullptr);
+    auto checkErrorReasons = [&core]() {
+        const auto &errorReasons1 = core->getErrorReasons();
+        auto errorReasons2 = core->getAstNode()->getErrorReasons();
+        ASSERT_EQ(errorReasons1.size(), errorReasons2.size());
+        for (size_t i = 0; i < errorReasons1.size(); ++i) {
+            EXPECT_EQ(*errorReasons1[i], *errorReasons2[i]);
+        }
+    };
+    std::u16string command = u"execute as @e[type=zombie] at @s run tp @s ~ ~1";
+    core->onTextChanged(command, command.length());
+    // 重复获取时返回同一个对象，没有重新计算
+    const std::u16string *structure = &core->getStructure();
+    const std::u16string *description = &core->getDescription();
+    const std::vector<std::shared_ptr<CHelper::ErrorReason>> *errorReasons = &core->getErrorReasons();
+    const CHelper::ColoredString *colors = &core->getColors();
+    EXPECT_EQ(&core->getStructure(), structure);
+    EXPECT_EQ(&core->getDescription(), description);
+    EXPECT_EQ(&core->getErrorReasons(), errorReasons);
+    EXPECT_EQ(&core->getColors(), colors);
+    // 内容和光标位置没有改变时不会清空
+    core->onTextChanged(command, command.length());
+    EXPECT_EQ(&core->getStructure(), structure);
+    EXPECT_EQ(&core->getDescription(), description);
+    EXPECT_EQ(&core->getErrorReasons(), errorReasons);
+    EXPECT_EQ(&core->getColors(), colors);
+    // 光标位置改变后重新计算说明，其他结果不变
+    core->onSelectionChanged(8);
+    EXPECT_EQ(core->getDescription(), core->getAstNode()->getDescription(8));
+    EXPECT_EQ(&core->getStructure(), structure);
+    EXPECT_EQ(&core->getColors(), colors);
+    // 主题改变后重新计算颜色，新的结果创建时旧的结果还没有释放，所以地址一定不同
+    core->settings.theme.colorCommand = 0x12345678;
+    const CHelper::ColoredString &colors2 = core->getColors();
+    EXPECT_NE(&colors2, colors);
+    EXPECT_EQ(colors2.colors, core->getAstNode()->getColors(core->settings.theme).colors);
+    EXPECT_NE(std::find(colors2.colors.begin(), colors2.colors.end(), 0x12345678), colors2.colors.end());
+    EXPECT_EQ(&core->getColors(), &colors2);
+    EXPECT_EQ(&core->getStructure(), structure);
+    // 内容改变后全部重新计算
+    std::u16string oldStructure = core->getStructure();
+    std::vector<uint32_t> oldColors = core->getColors().colors;
+    std::u16string command2 = u"give @s apple 1 0 {";
+    core->onTextChanged(command2, command2.length());
+    EXPECT_EQ(core->getStructure(), core->getAstNode()->getStructure());
+    EXPECT_NE(core->getStructure(), oldStructure);
+    EXPECT_EQ(core->getDescription(), core->getAstNode()->getDescription(command2.length()));
+    EXPECT_EQ(core->getColors().colors, core->getAstNode()->getColors(core->settings.theme).colors);
+    EXPECT_NE(core->getColors().colors, oldColors);
+    checkErrorReasons();
+}
@@ -0,0 +1,78 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <gtest/gtest.h>
+
+#include <chelper/CHelperCore.h>
+#include <chelper/util/LatencyHistogram.h>
+
+TEST(StatisticsTest, LatencyHistogram) {
+    for (uint64_t value: std::vector<uint64_t>{0, 1, 7, 8, 15, 16, 1000, 123456789, UINT64_MAX}) {
+        size_t index = CHelper::LatencyHistogram::getBucketIndex(value);
+        EXPECT_LT(index, CHelper::LatencyHistogram::BUCKET_COUNT);
+        EXPECT_GE(CHelper::LatencyHistogram::getBucketUpperBound(index), value);
+        if (index > 0) {
+            EXPECT_LT(CHelper::LatencyHistogram::getBucketUpperBound(index - 1), value);
+        }
+    }
+    CHelper::LatencyHistogram histogram;
+    EXPECT_EQ(histogram.getPercentile(50), 0);
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        histogram.record(i * 1000);
+    }
+    CHelper::LatencySnapshot snapshot = histogram.getSnapshot();
+    EXPECT_EQ(snapshot.count, 1000);
+    EXPECT_EQ(snapshot.max, 1000000);
+    // 相对误差不超过12.5%
+    EXPECT_GE(snapshot.p50, 500000);
+    EXPECT_LE(snapshot.p50, 562500);
+    EXPECT_GE(snapshot.p99, 990000);
+    EXPECT_LE(snapshot.p99, 1000000);
+}
+
+/**
+ * 开启统计后可以得到每种节点的解析次数和每个方法的耗时，没有开启时不会记录
+ */
+TEST(StatisticsTest, CoreStatistics) {
+    std::filesystem::path resourceDir(RESOURCE_DIR);
+    std::unique_ptr<CHelper::CHelperCore> core(CHelper::CHelperCore::createByDirectory(resourceDir / "resources" / "beta" / "vanilla"));
+    ASSERT_NE(core, nullptr);
+    core->onTextChanged(u"give @s apple", 13);
+    EXPECT_EQ(core->getStatistics().parseCount, 0);
+    core->settings.isEnableStatistics = true;
+    std::u16string command = u"execute as @e[type=zombie,tag=a] at @s run tp @s ~ ~1 ~";
+    core->onTextChanged(command, command.length());
+    core->getSuggestions();
+    core->getErrorReasons();
+    CHelper::CoreStatistics statistics = core->getStatistics();
+    EXPECT_EQ(statistics.parseCount, 1);
+    EXPECT_GT(statistics.lastParse.getASTNodeCounts[CHelper::Node::NodeTypeId::COMMAND], 0);
+    EXPECT_GT(statistics.lastParse.getASTNodeCounts[CHelper::Node::NodeTypeId::TARGET_SELECTOR], 0);
+    EXPECT_GT(statistics.lastParse.backtrackTokens, 0);
+    EXPECT_EQ(statistics.total.getASTNodeCount(), statistics.lastParse.getASTNodeCount());
+    EXPECT_EQ(statistics.latencies[CHelper::CoreEntryPoint::ON_TEXT_CHANGED].count, 1);
+    EXPECT_EQ(statistics.latencies[CHelper::CoreEntryPoint::GET_SUGGESTIONS].count, 1);
+    EXPECT_EQ(statistics.latencies[CHelper::CoreEntryPoint::GET_COLORS].count, 0);
+    // 内容没有改变时不会重新解析
+    core->onTextChanged(command, 0);
+    EXPECT_EQ(core->getStatistics().parseCount, 1);
+    core->clearStatistics();
+    EXPECT_EQ(core->getStatistics().total.getASTNodeCount(), 0);
+}
+
+/**
+ * 节点直接调用子节点的getASTNode时也要计入统计
+ */
+TEST(StatisticsTest, DirectChildNodes) {
+    std::filesystem::path resourceDir(RESOURCE_DIR);
+    std::unique_ptr<CHelper::CHelperCore> core(CHelper::CHelperCore::createByDirectory(resourceDir / "resources" / "beta" / "vanilla"));
+    ASSERT_NE(core, nullptr);
+    core->settings.isEnableStatistics = true;
+    // 物品节点直接调用物品ID节点
+    std::u16string command = u"give @s apple 1 0";
+    core->onTextChanged(command, command.length());
+    CHelper::CoreStatistics statistics = core->getStatistics();
+    EXPECT_GT(statistics.lastParse.getASTNodeCounts[CHelper::Node::NodeTypeId::ITEM], 0);
+    EXPECT_GT(statistics.lastParse.getASTNodeCounts[CHelper::Node::NodeTypeId::NAMESPACE_ID], 0);
+}
@@ -0,0 +1,108 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <gtest/gtest.h>
+
+#include <chelper/parser/Suggestions.h>
+
+static std::vector<std::shared_ptr<CHelper::NormalId>> makeIds(const std::vector<std::u16string> &names) {
+    std::vector<std::shared_ptr<CHelper::NormalId>> result;
+    result.reserve(names.size());
+    for (const auto &item: names) {
+        result.push_back(CHelper::NormalId::make(item, std::nullopt));
+    }
+    return result;
+}
+
+static CHelper::Suggestions makeLazy(const std::shared_ptr<std::vector<std::shared_ptr<CHelper::NormalId>>> &ids, size_t *createCount) {
+    return CHelper::Suggestions::lazyIdSuggestions(0, 1, true, ids->size(), [ids, createCount](size_t which) {
+        (*createCount)++;
+        return ids->at(which);
+    });
+}
+
+/**
+ * 延迟生成的补全提示只在获取时才创建，分页获取的结果和一次获取所有的结果相同
+ */
+TEST(SuggestionsTest, SuggestionList) {
+    auto ids = std::make_shared<std::vector<std::shared_ptr<CHelper::NormalId>>>(makeIds({u"a", u"b", u"c", u"d", u"e"}));
+    auto literals = makeIds({u"true", u"false"});
+    size_t createCount = 0;
+    std::vector<CHelper::Suggestions> suggestions;
+    suggestions.push_back(makeLazy(ids, &createCount));
+    CHelper::Suggestions literal(CHelper::SuggestionsType::LITERAL);
+    literal.suggestions.emplace_back(0, 1, true, literals[0]);
+    literal.suggestions.emplace_back(0, 1, true, literals[1]);
+    literal.suggestions.emplace_back(0, 1, true, literals[0]);
+    suggestions.push_back(std::move(literal));
+    // 相同的一组补全提示只保留一个
+    suggestions.push_back(makeLazy(ids, &createCount));
+    suggestions.push_back(CHelper::Suggestions::singleWhitespaceSuggestion({0, 1, false, CHelper::NormalId::make(u" ", std::nullopt)}));
+    CHelper::SuggestionList suggestionList(std::move(suggestions));
+    EXPECT_EQ(suggestionList.size(), 8);
+    // 数量相同的两组补全提示需要计算哈希值，这时只获取内容，获取一段补全提示时只获取这一段的内容
+    EXPECT_EQ(createCount, 10);
+    createCount = 0;
+    std::vector<CHelper::Suggestion> page = suggestionList.get(2, 3);
+    EXPECT_EQ(createCount, 2);
+    ASSERT_EQ(page.size(), 3);
+    EXPECT_EQ(page[0].content->name, u"false");
+    EXPECT_EQ(page[1].content->name, u"a");
+    EXPECT_EQ(page[2].content->name, u"b");
+    std::vector<std::u16string> names;
+    for (size_t offset = 0; offset < suggestionList.size(); offset += 3) {
+        for (const auto &item: suggestionList.get(offset, 3)) {
+            names.push_back(item.content->name);
+        }
+    }
+    std::vector<std::u16string> expected = {u" ", u"true", u"false", u"a", u"b", u"c", u"d", u"e"};
+    EXPECT_EQ(names, expected);
+    EXPECT_EQ(suggestionList.getAll().size(), 8);
+    EXPECT_EQ(suggestionList.at(7).content->name, u"e");
+    EXPECT_TRUE(suggestionList.get(8, 3).empty());
+    EXPECT_THROW(static_cast<void>(suggestionList.at(8)), std::out_of_range);
+}
+
+/**
+ * 延迟生成的补全提示和普通的补全提示内容相同时哈希值相同，只保留先添加的一组
+ */
+TEST(SuggestionsTest, LazyAndEagerDedup) {
+    auto ids = std::make_shared<std::vector<std::shared_ptr<CHelper::NormalId>>>(makeIds({u"a", u"b", u"c"}));
+    auto makeEager = [&ids](size_t start, size_t end) {
+        CHelper::Suggestions result(CHelper::SuggestionsType::ID);
+        for (const auto &item: *ids) {
+            result.suggestions.emplace_back(start, end, true, item);
+        }
+        return result;
+    };
+    size_t createCount = 0;
+    // 普通的一组在前，延迟生成的一组被去掉
+    std::vector<CHelper::Suggestions> suggestions1;
+    suggestions1.push_back(makeEager(0, 1));
+    suggestions1.push_back(makeLazy(ids, &createCount));
+    CHelper::SuggestionList suggestionList1(std::move(suggestions1));
+    EXPECT_EQ(suggestionList1.size(), 3);
+    EXPECT_EQ(createCount, 3);
+    // 延迟生成的一组在前，普通的一组被去掉
+    createCount = 0;
+    std::vector<CHelper::Suggestions> suggestions2;
+    suggestions2.push_back(makeLazy(ids, &createCount));
+    suggestions2.push_back(makeEager(0, 1));
+    CHelper::SuggestionList suggestionList2(std::move(suggestions2));
+    EXPECT_EQ(suggestionList2.size(), 3);
+    EXPECT_EQ(createCount, 3);
+    std::vector<CHelper::Suggestion> all1 = suggestionList1.getAll();
+    std::vector<CHelper::Suggestion> all2 = suggestionList2.getAll();
+    ASSERT_EQ(all1.size(), all2.size());
+    for (size_t i = 0; i < all1.size(); ++i) {
+        EXPECT_TRUE(all1[i].equal(all2[i]));
+        EXPECT_EQ(all1[i].hashCode(), all2[i].hashCode());
+    }
+    // 替换的范围不同时不是相同的补全提示，两组都保留
+    std::vector<CHelper::Suggestions> suggestions3;
+    suggestions3.push_back(makeLazy(ids, &createCount));
+    suggestions3.push_back(makeEager(0, 2));
+    CHelper::SuggestionList suggestionList3(std::move(suggestions3));
+    EXPECT_EQ(suggestionList3.size(), 6);
+}
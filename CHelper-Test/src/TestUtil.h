@@ -0,0 +1,84 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#pragma once
+
+#ifndef CHELPER_TESTUTIL_H
+#define CHELPER_TESTUTIL_H
+
+#include <chelper/resources/CPack.h>
+#include <fstream>
+
+/**
+ * 多个测试共用的命令和资源包
+ */
+namespace CHelper::Test {
+
+    /**
+     * 测试使用的命令
+     */
+    inline std::vector<std::u16string> getTestCommands() {
+        return {
+            uR"(execute run clear )",
+            uR"(give @s[hasitem=[{item=air,data=1},{item=minecraft:bed}],has_property={minecraft:is_rolled_up=true,m)",
+            uR"(give @s command_block 112 12 {"minecraft:can_place_on":{"blocks":[")",
+            uR"(tellraw @a {"rawtext":[{"text":"aaa","selector":"@a[type=\")",
+            uR"(execute if block 12~23~)",
+            uR"(give @s stone 12 21 {"minecraft:item_lock":{"mode":"l)",
+            uR"(execute if block ~~~ anvil["aaa"=90.5] run g)",
+            uR"(setblock ~~~ stone[)",
+            uR"(give @s stone 12 1)",
+            uR"(tag @s add "\\\"\u1110\/\b\f\n\r\t\p\")",
+            uR"(give @s command_block 12 12 {"minecraft:can_destroy":{"blocks":["minecraft:acacia_door"]}})",
+            uR"(give @s s)",
+            uR"(give @s stone 1 1 {)",
+            uR"(give @s 石头)",
+            uR"(give @s command_block 12 12 {"minecraft:can_destroy":{"blocks":[")",
+            uR"(give)",
+            uR"(give @)",
+            uR"(give @a[x=^,has_property={""=!..12,="..}})",
+            uR"(execute as @a run)",
+            uR"(execute run)",
+            uR"(execute if block ~~~ command_block run)",
+            uR"(execute if block ~~~ bamboo)",
+            uR"(give @s apple 12 1)",
+            uR"(spreadplayers ~ ~ 0 1200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000)",
+            uR"(camerashake add @a 10000000000000000000000000000000000000000000000000000 3402823466385288598117041834845169254401)",
+            uR"(setblock ~~~ candle_cake[lit=)",
+            uR"(give @s repeating_command_block)",
+        };
+    }
+
+    inline std::filesystem::path getCPackPath(const std::string &branch1 = "beta", const std::string &branch2 = "vanilla") {
+        return std::filesystem::path(RESOURCE_DIR) / "resources" / branch1 / branch2;
+    }
+
+    /**
+     * 从文件夹读取资源包，失败时输出错误信息并返回nullptr，调用的地方需要使用ASSERT_NE检查
+     */
+    inline std::unique_ptr<CPack> createCPack(const std::filesystem::path &cpackPath = getCPackPath()) {
+        try {
+            return CPack::createByDirectory(cpackPath);
+        } catch (const std::exception &e) {
+            Profile::printAndClear(e);
+            return nullptr;
+        }
+    }
+
+    /**
+     * 把资源包写入临时文件，然后读取文件的内容
+     */
+    inline std::string writeBinary(const CPack &cpack, const std::string &fileName) {
+        std::filesystem::path binaryPath = std::filesystem::temp_directory_path() / fileName;
+        cpack.writeBinToFile(binaryPath);
+        std::ifstream istream(binaryPath, std::ios::binary);
+        std::string result((std::istreambuf_iterator<char>(istream)), std::istreambuf_iterator<char>());
+        istream.close();
+        std::filesystem::remove(binaryPath);
+        return result;
+    }
+
+}// namespace CHelper::Test
+
+#endif//CHELPER_TESTUTIL_H
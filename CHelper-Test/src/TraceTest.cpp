@@ -0,0 +1,66 @@
+//
+// Created by agent on 2026-10-17.
+//
+
+#include <gtest/gtest.h>
+
+#include <chelper/util/Trace.h>
+
+/**
+ * 没有开启CHELPER_TRACE编译选项或者没有开始记录时，宏不会格式化参数，也不会留下记录
+ */
+TEST(TraceTest, DisabledMacros) {
+    bool isFormatted = false;
+    [[maybe_unused]] auto getArg = [&isFormatted]() {
+        isFormatted = true;
+        return 1;
+    };
+    {
+        CHELPER_TRACE_SCOPE_ARGS("disabled", "{}", getArg());
+        CHELPER_TRACE_NEXT("disabled next");
+    }
+    EXPECT_FALSE(isFormatted);
+#ifdef CHelperTrace
+    EXPECT_FALSE(CHelper::Trace::isEnabled());
+    std::ostringstream ostream;
+    CHelper::Trace::writeChromeTrace(ostream);
+    EXPECT_EQ(ostream.str().find("disabled"), std::string::npos);
+#endif
+}
+
+#ifdef CHelperTrace
+
+/**
+ * 没有开始记录时不会格式化参数，开始记录后可以导出嵌套的记录
+ */
+TEST(TraceTest, WriteChromeTrace) {
+    CHelper::Trace::clear();
+    bool isFormatted = false;
+    {
+        CHelper::Trace::Scope scope("disabled", [&isFormatted]() {
+            isFormatted = true;
+            return std::string();
+        });
+    }
+    EXPECT_FALSE(isFormatted);
+    CHelper::Trace::setEnabled(true);
+    {
+        CHELPER_TRACE_SCOPE_ARGS("outer", "{} \"{}\"", 1, std::u16string(u"command"));
+        {
+            CHELPER_TRACE_SCOPE("inner1");
+            CHELPER_TRACE_NEXT("inner2");
+        }
+    }
+    CHelper::Trace::setEnabled(false);
+    std::ostringstream ostream;
+    CHelper::Trace::writeChromeTrace(ostream);
+    std::string json = ostream.str();
+    EXPECT_EQ(json.find("disabled"), std::string::npos);
+    EXPECT_NE(json.find(R"("name":"inner1")"), std::string::npos);
+    EXPECT_NE(json.find(R"("name":"inner2")"), std::string::npos);
+    EXPECT_NE(json.find(R"("name":"outer")"), std::string::npos);
+    EXPECT_NE(json.find(R"("args":{"detail":"1 \"command\""})"), std::string::npos);
+    CHelper::Trace::clear();
+}
+
+#endif
@@ -111,25 +111,19 @@ public:
         if (HEDLEY_UNLIKELY(core == nullptr)) {
             return 0;
         }
-        auto suggestions = core->getSuggestions();
-        if (suggestions == nullptr) {
-            return 0;
-        }
-        return suggestions->size();
+        return core->getSuggestionCount();
     }
 
     const char *getSuggestionTitle(size_t which) {
         if (HEDLEY_UNLIKELY(core == nullptr)) {
             return nullptr;
         }
-        auto suggestions = core->getSuggestions();
-        if (suggestions == nullptr) {
-            return nullptr;
-        }
-        if (which >= suggestions->size()) {
+        // 只创建需要的补全提示，不需要生成所有的补全提示
+        std::vector<CHelper::Suggestion> suggestions = core->getSuggestions(which, 1);
+        if (suggestions.empty()) {
             return nullptr;
         }
-        tempStr = utf8::utf16to8(suggestions->at(which).content->name);
+        tempStr = utf8::utf16to8(suggestions[0].content->name);
         return tempStr.c_str();
     }
 
@@ -137,14 +131,11 @@ public:
         if (HEDLEY_UNLIKELY(core == nullptr)) {
             return nullptr;
         }
-        auto suggestions = core->getSuggestions();
-        if (suggestions == nullptr) {
-            return nullptr;
-        }
-        if (which >= suggestions->size()) {
+        std::vector<CHelper::Suggestion> suggestions = core->getSuggestions(which, 1);
+        if (suggestions.empty()) {
             return nullptr;
         }
-        const std::optional<std::u16string> &suggestDescription = suggestions->at(which).content->description;
+        const std::optional<std::u16string> &suggestDescription = suggestions[0].content->description;
         if (suggestDescription == std::nullopt) {
             return nullptr;
         } else {
@@ -157,11 +148,7 @@ public:
 extern "C" {
 
 EMSCRIPTEN_KEEPALIVE WrappedCHelperCore *init(const char *cpackPtr, size_t cpackLength) {
-    return new WrappedCHelperCore(CHelper::CHelperCore::create([&cpackPtr, &cpackLength]() -> std::unique_ptr<CHelper::CPack> {
-        std::string str = std::string(cpackPtr, cpackLength);
-        std::istringstream iss(str);
-        return CHelper::CPack::createByBinary(iss);
-    }));
+    return new WrappedCHelperCore(CHelper::CHelperCore::createByBinary(cpackPtr, cpackLength));
 }
 
 EMSCRIPTEN_KEEPALIVE void release(const WrappedCHelperCore *core) {